@@ -0,0 +1,334 @@
+#include "AsyncImage.hpp"
+
+#include "gl_errors.hpp"
+#include "GLState.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+//---------------- internal state ----------------
+
+namespace {
+	//a decoded image whose pixels a worker is copying into a pixel-unpack buffer (mapped on the GL thread):
+	struct Upload {
+		std::shared_ptr< AsyncImage::Image > image;
+		GLuint buffer = 0;
+		void *mapped = nullptr;
+		std::atomic< bool > copied{false}; //set by the worker once 'mapped' holds the pixels
+	};
+
+	struct Loader {
+		std::mutex mutex;
+		std::condition_variable work_cv;
+		std::deque< std::shared_ptr< AsyncImage::Image > > work; //waiting to be decoded
+		std::deque< std::shared_ptr< Upload > > copies; //waiting to be copied (workers do these before decoding more)
+		std::vector< std::thread > workers;
+		bool stopping = false;
+
+		//images requested so far (weak, so pixels/textures are freed once nobody is using them):
+		std::map< std::tuple< std::string, int, uint32_t, bool, bool, bool >, std::weak_ptr< AsyncImage::Image > > cache;
+
+		//images that want textures and haven't been uploaded yet (only touched on the GL thread):
+		std::vector< std::shared_ptr< AsyncImage::Image > > to_upload;
+
+		//images with mapped buffers, being copied or waiting for glTexImage2D (only touched on the GL thread):
+		std::vector< std::shared_ptr< Upload > > uploads;
+
+		GLuint unpack_buffer = 0;
+	};
+
+	Loader &get_loader() {
+		static Loader loader;
+		return loader;
+	}
+
+	//box-filter 'data' down by a factor of two in each dimension:
+	void halve(glm::uvec2 *size_, std::vector< glm::u8vec4 > *data_) {
+		glm::uvec2 &size = *size_;
+		std::vector< glm::u8vec4 > &data = *data_;
+		glm::uvec2 half = glm::max(size / 2U, glm::uvec2(1));
+		std::vector< glm::u8vec4 > halved(half.x * half.y);
+		for (uint32_t y = 0; y < half.y; ++y) {
+			uint32_t y0 = std::min(2 * y, size.y - 1);
+			uint32_t y1 = std::min(2 * y + 1, size.y - 1);
+			for (uint32_t x = 0; x < half.x; ++x) {
+				uint32_t x0 = std::min(2 * x, size.x - 1);
+				uint32_t x1 = std::min(2 * x + 1, size.x - 1);
+				glm::uvec4 sum = glm::uvec4(data[y0 * size.x + x0])
+				               + glm::uvec4(data[y0 * size.x + x1])
+				               + glm::uvec4(data[y1 * size.x + x0])
+				               + glm::uvec4(data[y1 * size.x + x1]);
+				halved[y * half.x + x] = glm::u8vec4((sum + glm::uvec4(2)) / 4U);
+			}
+		}
+		data = std::move(halved);
+		size = half;
+	}
+
+	void worker_main() {
+		Loader &loader = get_loader();
+		while (true) {
+			std::shared_ptr< AsyncImage::Image > image;
+			std::shared_ptr< Upload > upload;
+			{
+				std::unique_lock< std::mutex > lock(loader.mutex);
+				loader.work_cv.wait(lock, [&](){ return loader.stopping || !loader.work.empty() || !loader.copies.empty(); });
+				if (loader.stopping) return;
+				//copies first, since a texture is waiting on each of them:
+				if (!loader.copies.empty()) {
+					upload = loader.copies.front();
+					loader.copies.pop_front();
+				} else {
+					image = loader.work.front();
+					loader.work.pop_front();
+				}
+			}
+
+			if (upload) {
+				std::vector< glm::u8vec4 > const &data = upload->image->data;
+				std::memcpy(upload->mapped, data.data(), data.size() * sizeof(glm::u8vec4));
+				upload->copied.store(true, std::memory_order_release);
+				continue;
+			}
+
+			try {
+				load_png(image->filename, &image->size, &image->data, image->options.origin);
+				if (image->options.max_size != 0) {
+					while (image->size.x > image->options.max_size || image->size.y > image->options.max_size) {
+						halve(&image->size, &image->data);
+					}
+				}
+				image->state.store(AsyncImage::Image::Decoded, std::memory_order_release);
+			} catch (std::exception &e) {
+				image->error = e.what();
+				image->data.clear();
+				std::cerr << "WARNING: failed to load image '" << image->filename << "': " << image->error << std::endl;
+				image->state.store(AsyncImage::Image::Failed, std::memory_order_release);
+			}
+		}
+	}
+
+	//make 'image.tex' from the pixels in 'buffer' (mapped and filled by a worker) or, if buffer is 0, from 'image.data';
+	// then free the pixels and mark the image Ready:
+	void finish_texture(AsyncImage::Image &image, GLuint buffer) {
+		GLenum internal_format = (image.options.srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8);
+		if (image.tex == 0) glGenTextures(1, &image.tex);
+
+		bool from_buffer = false;
+		if (buffer) {
+			GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+			//(unmapping fails if the buffer's contents were lost, e.g. to a display mode change)
+			from_buffer = (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE);
+			if (!from_buffer) GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
+
+		if (from_buffer) {
+			GLState::bind_texture(GL_TEXTURE_2D, image.tex);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			//source is the unpack buffer, so the copy happens asynchronously:
+			glTexImage2D(GL_TEXTURE_2D, 0, internal_format, image.size.x, image.size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLbyte *)0);
+			GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		} else {
+			AsyncImage::upload_rgba(image.tex, image.size, image.data.data(), internal_format);
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		if (image.options.mipmaps) {
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+			glGenerateMipmap(GL_TEXTURE_2D);
+		} else {
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		}
+		GLState::bind_texture(GL_TEXTURE_2D, 0);
+
+		//pixels live on the GPU from now on:
+		image.data.clear();
+		image.data.shrink_to_fit();
+		image.state.store(AsyncImage::Image::Ready, std::memory_order_release);
+	}
+}
+
+//---------------- AsyncImage ----------------
+
+AsyncImage::Image::~Image() {
+	if (tex) {
+		GLState::delete_textures(1, &tex);
+		tex = 0;
+	}
+}
+
+void AsyncImage::init(uint32_t threads) {
+	Loader &loader = get_loader();
+	assert(loader.workers.empty() && "AsyncImage::init should only be called once");
+
+	if (threads == 0) {
+		//leave the main thread (and the audio thread) some room:
+		threads = std::clamp(std::thread::hardware_concurrency(), 2U, 6U) - 1U;
+	}
+	loader.stopping = false;
+	for (uint32_t i = 0; i < threads; ++i) {
+		loader.workers.emplace_back(worker_main);
+	}
+}
+
+void AsyncImage::shutdown() {
+	Loader &loader = get_loader();
+	{
+		std::unique_lock< std::mutex > lock(loader.mutex);
+		loader.stopping = true;
+		loader.work.clear();
+		loader.copies.clear();
+	}
+	loader.work_cv.notify_all();
+	for (auto &worker : loader.workers) {
+		worker.join();
+	}
+	loader.workers.clear();
+
+	//drop images waiting for upload (images still referenced elsewhere keep their textures until destroyed):
+	loader.to_upload.clear();
+	loader.cache.clear();
+
+	//(workers are stopped, so nothing is writing to these any more)
+	for (auto &upload : loader.uploads) {
+		GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, upload->buffer);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		GLState::delete_buffers(1, &upload->buffer);
+	}
+	loader.uploads.clear();
+
+	if (loader.unpack_buffer) {
+		GLState::delete_buffers(1, &loader.unpack_buffer);
+		loader.unpack_buffer = 0;
+	}
+}
+
+std::shared_ptr< AsyncImage::Image > AsyncImage::load(std::string const &filename, Options const &options) {
+	Loader &loader = get_loader();
+	assert(!loader.workers.empty() && "AsyncImage::init must be called before AsyncImage::load");
+
+	auto key = std::make_tuple(filename, int(options.origin), options.max_size, options.make_texture, options.srgb, options.mipmaps);
+
+	std::shared_ptr< Image > image;
+	{
+		std::unique_lock< std::mutex > lock(loader.mutex);
+		auto f = loader.cache.find(key);
+		if (f != loader.cache.end()) {
+			if (auto cached = f->second.lock()) return cached;
+			loader.cache.erase(f);
+		}
+
+		image = std::make_shared< Image >();
+		image->filename = filename;
+		image->options = options;
+		loader.cache.emplace(key, image);
+		loader.work.emplace_back(image);
+	}
+	loader.work_cv.notify_one();
+
+	if (options.make_texture) loader.to_upload.emplace_back(image);
+
+	return image;
+}
+
+void AsyncImage::upload_rgba(GLuint tex, glm::uvec2 size, glm::u8vec4 const *data, GLenum internal_format) {
+	Loader &loader = get_loader();
+	if (loader.unpack_buffer == 0) glGenBuffers(1, &loader.unpack_buffer);
+
+	GLsizeiptr bytes = GLsizeiptr(size.x) * GLsizeiptr(size.y) * GLsizeiptr(sizeof(glm::u8vec4));
+
+	GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, loader.unpack_buffer);
+	//orphan the previous contents so we never wait on an in-flight upload:
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+	void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (mapped) {
+		std::memcpy(mapped, data, size_t(bytes));
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	}
+
+	GLState::bind_texture(GL_TEXTURE_2D, tex);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (mapped) {
+		//source is the unpack buffer, so the copy happens asynchronously:
+		glTexImage2D(GL_TEXTURE_2D, 0, internal_format, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLbyte *)0);
+		GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	} else {
+		//mapping failed (shouldn't happen), so fall back to a client-memory upload:
+		GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glTexImage2D(GL_TEXTURE_2D, 0, internal_format, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
+
+	GL_ERRORS();
+}
+
+void AsyncImage::update(size_t byte_budget) {
+	Loader &loader = get_loader();
+
+	//turn pixels the workers have finished copying into textures:
+	for (auto &upload : loader.uploads) {
+		if (!upload->copied.load(std::memory_order_acquire)) continue;
+		finish_texture(*upload->image, upload->buffer);
+		GLState::delete_buffers(1, &upload->buffer);
+		upload.reset();
+	}
+	loader.uploads.erase(std::remove(loader.uploads.begin(), loader.uploads.end(), nullptr), loader.uploads.end());
+
+	//map a buffer for each newly-decoded image and hand the copy into it to a worker:
+	std::vector< std::shared_ptr< Upload > > copies;
+	size_t staged = 0;
+	bool staged_any = false;
+	for (auto &image : loader.to_upload) {
+		if (!image) continue;
+		Image::State state = image->state.load(std::memory_order_acquire);
+		if (state == Image::Failed) {
+			image.reset();
+			continue;
+		}
+		if (state != Image::Decoded) continue;
+
+		size_t bytes = image->data.size() * sizeof(glm::u8vec4);
+		if (staged_any && staged + bytes > byte_budget) break;
+
+		auto upload = std::make_shared< Upload >();
+		upload->image = image;
+		glGenBuffers(1, &upload->buffer);
+		GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, upload->buffer);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, GLsizeiptr(bytes), nullptr, GL_STREAM_DRAW);
+		upload->mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, GLsizeiptr(bytes), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		GLState::bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+		if (upload->mapped) {
+			loader.uploads.emplace_back(upload);
+			copies.emplace_back(std::move(upload));
+		} else {
+			//mapping failed (shouldn't happen), so upload right away instead:
+			GLState::delete_buffers(1, &upload->buffer);
+			finish_texture(*image, 0);
+		}
+		image.reset();
+
+		staged += bytes;
+		staged_any = true;
+	}
+
+	loader.to_upload.erase(std::remove(loader.to_upload.begin(), loader.to_upload.end(), nullptr), loader.to_upload.end());
+
+	if (!copies.empty()) {
+		{
+			std::unique_lock< std::mutex > lock(loader.mutex);
+			loader.copies.insert(loader.copies.end(), copies.begin(), copies.end());
+		}
+		loader.work_cv.notify_all();
+	}
+
+	GL_ERRORS();
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "GL.hpp"
+#include "load_save_png.hpp"
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+//Asynchronous image loading.
+// PNGs are decoded on worker threads directly into the layout glTexImage2D wants
+// (tightly-packed RGBA8, rows in 'origin' order) so no repacking is needed.
+// AsyncImage::update(), called once per frame on the GL thread, maps a pixel-unpack
+// buffer for each decoded image and has a worker copy the pixels into it; a later
+// update() unmaps the buffer and creates the texture from it. So the GL thread never
+// copies pixels itself, and a texture shows up a frame or so after its image is decoded.
+//
+//Usage:
+//  auto image = AsyncImage::load(data_path("thing.png"));
+//  ...each frame:
+//  if (image->ready()) { GLState::bind_texture(GL_TEXTURE_2D, image->tex); ... }
+//
+//Loads are cached by (filename, options) for as long as some handle to the image is alive,
+// so repeated loads are free.
+
+namespace AsyncImage {
+
+struct Options {
+	OriginLocation origin = LowerLeftOrigin; //LowerLeftOrigin matches OpenGL's texture layout
+	uint32_t max_size = 0; //if nonzero, box-filter down by powers of two until both dimensions are <= max_size
+	bool make_texture = true; //upload a texture (and then release the pixels) once decoded
+	bool srgb = true; //texture internal format is GL_SRGB8_ALPHA8 (otherwise GL_RGBA8)
+	bool mipmaps = true; //generate mipmaps (and use trilinear filtering) for the texture
+};
+
+struct Image {
+	enum State : uint32_t {
+		Pending, //waiting for / being decoded by a worker
+		Decoded, //pixels available in 'data' (texture not yet uploaded)
+		Ready, //texture uploaded (or, if !make_texture, same as Decoded)
+		Failed, //decoding failed; see 'error'
+	};
+	std::atomic< State > state{Pending};
+
+	std::string filename;
+	Options options;
+
+	//set by the worker before state becomes Decoded:
+	glm::uvec2 size = glm::uvec2(0);
+	std::vector< glm::u8vec4 > data;
+	std::string error;
+
+	//set on the GL thread when state becomes Ready (if options.make_texture):
+	GLuint tex = 0;
+
+	//pixels are available (for CPU-side use, e.g. atlas packing):
+	bool decoded() const {
+		State s = state.load(std::memory_order_acquire);
+		return s == Decoded || (s == Ready && !options.make_texture);
+	}
+	//texture (or, for !make_texture images, pixels) can be used:
+	bool ready() const {
+		State s = state.load(std::memory_order_acquire);
+		return s == Ready || (s == Decoded && !options.make_texture);
+	}
+	bool failed() const { return state.load(std::memory_order_acquire) == Failed; }
+	bool pending() const { return !ready() && !failed(); }
+
+	~Image();
+};
+
+//start worker threads (0 = choose based on hardware concurrency):
+void init(uint32_t threads = 0);
+
+//stop worker threads and free all GL objects owned by the loader:
+// (call before destroying the GL context)
+void shutdown();
+
+//request an image; returns immediately:
+std::shared_ptr< Image > load(std::string const &filename, Options const &options = Options());
+
+//upload decoded images as textures; call once per frame on the GL thread:
+// starts at most 'byte_budget' bytes of uploads per call (but always at least one image, so progress is made)
+void update(size_t byte_budget = 16 * 1024 * 1024);
+
+//upload tightly-packed RGBA8 pixels to 'tex' (level 0) through the loader's pixel-unpack buffer:
+// (unlike update(), this copies the pixels on the calling thread; the texture is bound to GL_TEXTURE_2D on the current texture unit when this returns)
+void upload_rgba(GLuint tex, glm::uvec2 size, glm::u8vec4 const *data, GLenum internal_format);
+
+}
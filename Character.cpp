@@ -1,6 +1,13 @@
 #include "Character.hpp"
 #include "PlayMode.hpp"
 
+#include <algorithm>
+#include <limits>
+
+// Solid contacts closer than this still count as touching, so a character that applySpeed
+// stopped exactly at a surface is still seen as standing on it:
+static constexpr float ContactSlop = 0.01f;
+
 Character::Character(PlayMode *_game) : game(_game)
 {
 }
@@ -12,14 +19,17 @@ void Character::update(float elapsed)
 }
 
 bool Character::collide(Scene::Transform *object, bool isTrigger)
+{
+    return resolve(collision->position, speed, collision->scale.y, object, isTrigger, &platform, &jumping);
+}
+
+bool Character::resolve(glm::vec3 &charPos, glm::vec3 &speed, float radius, Scene::Transform *object, bool isTrigger, Scene::Transform **platform, bool *jumping)
 {
     glm::vec3 object_pos = glm::vec3(object->position);
     object_pos.x = 0.0f;
     glm::vec3 object_size = object->scale;
 
-    glm::vec3 &charPos = collision->position;
     charPos.x = 0.0f;
-    glm::vec3 charSize = collision->scale;
 
     // Transform player position from world space to object's local space
     glm::quat invRotation = glm::inverse(object->rotation);
@@ -28,7 +38,7 @@ bool Character::collide(Scene::Transform *object, bool isTrigger)
 
     // Taken from https://developer.mozilla.org/en-US/docs/Games/Techniques/3D_collision_detection
     // Check the collision between a circle and a bounding box
-    auto intersects = ([](glm::vec3 sphereCenter, float sphereRadius, glm::vec3 boxMin, glm::vec3 boxMax)
+    auto intersects = ([isTrigger](glm::vec3 sphereCenter, float sphereRadius, glm::vec3 boxMin, glm::vec3 boxMax)
                        {
 		// get box closest point to sphere center by clamping
 		float y = std::max(boxMin.y, std::min(sphereCenter.y, boxMax.y));
@@ -39,7 +49,7 @@ bool Character::collide(Scene::Transform *object, bool isTrigger)
 					(z - sphereCenter.z) * (z - sphereCenter.z)
 				);
 
-		std::pair<bool, glm::vec3> solution(distance <= sphereRadius,
+		std::pair<bool, glm::vec3> solution(distance <= sphereRadius + (isTrigger ? 0.0f : ContactSlop),
 											glm::vec3(0.0f, y, z));
 
 		return solution; });
@@ -48,7 +58,7 @@ bool Character::collide(Scene::Transform *object, bool isTrigger)
     glm::vec3 boxMin = glm::vec3(0.0f, -object_size.y, -object_size.z);
     glm::vec3 boxMax = glm::vec3(0.0f, object_size.y, object_size.z);
 
-    std::pair<bool, glm::vec3> intersection = intersects(playerCenter, charSize.y, boxMin, boxMax);
+    std::pair<bool, glm::vec3> intersection = intersects(playerCenter, radius, boxMin, boxMax);
 
     // If the collision box is only a trigger, do not change the position/speed of the player
     if (isTrigger)
@@ -70,7 +80,7 @@ bool Character::collide(Scene::Transform *object, bool isTrigger)
         float distance = glm::length(collisionToPlayer);
 
         // Calculate penetration and collision normal
-        float penetration = charSize.y - distance;
+        float penetration = radius - distance;
 
         // The collision normal points from the closest point toward the player center
         // If distance is too small, we're at the center and need a fallback
@@ -110,12 +120,12 @@ bool Character::collide(Scene::Transform *object, bool isTrigger)
         // Check if the world normal has a significant upward (positive Z) component
         if (actualNormal.z > 0.7f)
         { // cos(45°) ≈ 0.707, so steeper than 45° upward
-            platform = object;
-            jumping = false;
+            *platform = object;
+            *jumping = false;
         }
         else
         {
-            platform = nullptr;
+            *platform = nullptr;
         }
 
         return true;
@@ -133,11 +143,162 @@ void Character::charJump(float char_jump_height, float jump_time, float jump_gra
     speed.z = jumpSpeed;
 }
 
-void Character::applySpeed(float elapsed)
+bool Character::sweep(glm::vec3 const &center, glm::vec3 const &displacement, float radius, Scene::Transform const *object, float *toi, glm::vec3 *normal)
+{
+    // Work in the box's local y-z plane (the same space collide uses):
+    glm::vec3 object_pos = object->position;
+    object_pos.x = 0.0f;
+    glm::quat invRotation = glm::inverse(object->rotation);
+    glm::vec3 local_p = invRotation * (glm::vec3(0.0f, center.y, center.z) - object_pos);
+    glm::vec2 p = glm::vec2(local_p.y, local_p.z);
+    glm::vec3 local_d = invRotation * glm::vec3(0.0f, displacement.y, displacement.z);
+    glm::vec2 d = glm::vec2(local_d.y, local_d.z);
+    glm::vec2 half = glm::vec2(object->scale.y, object->scale.z);
+
+    auto to_world = [&](glm::vec2 const &n) {
+        glm::vec3 world = object->rotation * glm::vec3(0.0f, n.x, n.y);
+        world.x = 0.0f;
+        float len = glm::length(world);
+        return (len > 0.0001f ? world / len : glm::vec3(0.0f, 0.0f, 1.0f));
+    };
+
+    { // Already touching? Only block motion that goes further in:
+        glm::vec2 closest = glm::clamp(p, -half, half);
+        glm::vec2 away = p - closest;
+        float dist2 = glm::dot(away, away);
+        if (dist2 <= radius * radius)
+        {
+            glm::vec2 n;
+            if (dist2 > 0.0001f * 0.0001f)
+                n = away / std::sqrt(dist2);
+            else
+            { // center is inside the box: push out along the axis of least penetration
+                glm::vec2 depth = half - glm::abs(p);
+                n = (depth.x < depth.y) ? glm::vec2(std::copysign(1.0f, p.x), 0.0f) : glm::vec2(0.0f, std::copysign(1.0f, p.y));
+            }
+            if (glm::dot(d, n) >= 0.0f)
+                return false;
+            *toi = 0.0f;
+            *normal = to_world(n);
+            return true;
+        }
+    }
+
+    // Ray from p along d against the box expanded by radius (slab test):
+    glm::vec2 expanded = half + glm::vec2(radius);
+    float t_enter = 0.0f;
+    float t_exit = 1.0f;
+    int enter_axis = -1;
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        if (std::abs(d[axis]) < 1e-8f)
+        {
+            if (p[axis] < -expanded[axis] || p[axis] > expanded[axis])
+                return false;
+            continue;
+        }
+        float inv = 1.0f / d[axis];
+        float t0 = (-expanded[axis] - p[axis]) * inv;
+        float t1 = (expanded[axis] - p[axis]) * inv;
+        if (t0 > t1)
+            std::swap(t0, t1);
+        if (t0 > t_enter)
+        {
+            t_enter = t0;
+            enter_axis = axis;
+        }
+        t_exit = std::min(t_exit, t1);
+        if (t_enter > t_exit)
+            return false;
+    }
+
+    // (enter_axis == -1 means p starts inside the expanded box, which -- since it isn't touching -- is in a rounded-off corner)
+    glm::vec2 hit = p + d * t_enter;
+    int other = 1 - enter_axis;
+    if (enter_axis != -1 && std::abs(hit[other]) <= half[other])
+    { // Face hit:
+        glm::vec2 n = glm::vec2(0.0f);
+        n[enter_axis] = std::copysign(1.0f, hit[enter_axis]);
+        *toi = t_enter;
+        *normal = to_world(n);
+        return true;
+    }
+
+    // Corner region: the expanded box is rounded there, so test against the circle around the nearest corner:
+    glm::vec2 corner = glm::vec2(std::copysign(half.x, hit.x), std::copysign(half.y, hit.y));
+    glm::vec2 m = p - corner;
+    float a = glm::dot(d, d);
+    float b = glm::dot(m, d);
+    float c = glm::dot(m, m) - radius * radius;
+    float discriminant = b * b - a * c;
+    if (discriminant < 0.0f || a < 1e-12f)
+        return false;
+    float t = (-b - std::sqrt(discriminant)) / a;
+    if (t < 0.0f || t > 1.0f)
+        return false;
+    *toi = t;
+    *normal = to_world(glm::normalize(m + d * t));
+    return true;
+}
+
+void Character::applySpeed(float elapsed, Colliders solids)
 {
     if (platform == nullptr)
         speed.z -= gravity * elapsed;
 
     // y-axis is the forward/backward direction and the x-axis is the right/left direction
-    collision->position += speed.y * glm::vec3(0.0f, 1.0f, 0.0f) * elapsed + speed.z * glm::vec3(0.0f, 0.0f, 1.0f) * elapsed;
+    glm::vec3 displacement = speed.y * glm::vec3(0.0f, 1.0f, 0.0f) * elapsed + speed.z * glm::vec3(0.0f, 0.0f, 1.0f) * elapsed;
+
+    if (noclip)
+    {
+        collision->position += displacement;
+        return;
+    }
+
+    move(collision->position, speed, collision->scale.y, displacement, solids);
+}
+
+void Character::move(glm::vec3 &position, glm::vec3 &speed, float radius, glm::vec3 displacement, Colliders solids)
+{
+    // Move to the first contact, remove the part of the motion going into the surface, and continue with the rest:
+    // (a few iterations handle sliding into a corner)
+    constexpr int MaxSlides = 3;
+    for (int slide = 0; slide < MaxSlides; ++slide)
+    {
+        float first_toi = std::numeric_limits<float>::infinity();
+        glm::vec3 first_normal = glm::vec3(0.0f);
+        for (auto const *list : solids)
+        {
+            for (Scene::Transform const *object : *list)
+            {
+                float toi;
+                glm::vec3 normal;
+                if (sweep(position, displacement, radius, object, &toi, &normal) && toi < first_toi)
+                {
+                    first_toi = toi;
+                    first_normal = normal;
+                }
+            }
+        }
+
+        if (first_toi > 1.0f)
+        {
+            position += displacement;
+            return;
+        }
+
+        position += displacement * first_toi;
+        displacement *= (1.0f - first_toi);
+
+        float into = glm::dot(displacement, first_normal);
+        if (into < 0.0f)
+            displacement -= into * first_normal;
+        float speed_into = glm::dot(speed, first_normal);
+        if (speed_into < 0.0f)
+        {
+            speed -= speed_into * first_normal;
+            speed.x = 0.0f;
+        }
+    }
+    // (out of iterations: drop the remaining motion rather than risk moving into something)
 }
\ No newline at end of file
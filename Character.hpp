@@ -11,6 +11,7 @@
 #include <vector>
 #include <deque>
 #include <cmath>
+#include <initializer_list>
 
 // Forward declaration to break circular dependency
 struct PlayMode;
@@ -51,8 +52,25 @@ struct Character
     // Collision between a character and an object
     bool collide(Scene::Transform *object, bool isTrigger);
 
+    // Collision between a circle (at 'position', moving with 'speed') and an object; collide() calls this with the character's own state:
+    // (for solid objects, pushes the circle out, cancels speed into the object, and sets *platform / *jumping when landing on top)
+    static bool resolve(glm::vec3 &position, glm::vec3 &speed, float radius, Scene::Transform *object, bool isTrigger, Scene::Transform **platform, bool *jumping);
+
     // Make the character jump to jump_height
     void charJump(float char_jump_height, float jump_time, float jump_grav);
 
-    void applySpeed(float elapsed);
+    // Lists of boxes that block movement (checked with a swept test in applySpeed):
+    using Colliders = std::initializer_list<std::vector<Scene::Transform *> const *>;
+
+    // Integrate speed over 'elapsed', stopping at (and sliding along) the first solid hit on the way,
+    // so fast-moving characters can't pass through thin boxes between updates:
+    void applySpeed(float elapsed, Colliders solids = {});
+
+    // Move a circle by 'displacement', stopping at and sliding along solids (used by applySpeed):
+    static void move(glm::vec3 &position, glm::vec3 &speed, float radius, glm::vec3 displacement, Colliders solids);
+
+    // Swept circle vs. oriented box in the y-z plane (box half-extents are object->scale):
+    // returns true if a circle of 'radius' at 'center' moving by 'displacement' touches 'object',
+    // setting 'toi' to the fraction [0,1] of the displacement at first contact and 'normal' to the world-space contact normal
+    static bool sweep(glm::vec3 const &center, glm::vec3 const &displacement, float radius, Scene::Transform const *object, float *toi, glm::vec3 *normal);
 };
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "CollisionGrid.hpp"
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// keep the grid (and so the per-query cell walk) reasonably small on large levels:
+static constexpr int32_t MaxCells = 1 << 16;
+
+void CollisionGrid::build(std::initializer_list< std::vector< Scene::Transform * > const * > lists, float cell_size_) {
+	objects.clear();
+	for (auto const *list : lists) {
+		objects.insert(objects.end(), list->begin(), list->end());
+	}
+
+	//y-z extents of each oriented box (ignoring local x, as Character::collide does):
+	bounds.resize(objects.size());
+	JobSystem::parallel_for(objects.size(), 256, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			Scene::Transform const *object = objects[i];
+			glm::vec3 axis_y = object->rotation * glm::vec3(0.0f, object->scale.y, 0.0f);
+			glm::vec3 axis_z = object->rotation * glm::vec3(0.0f, 0.0f, object->scale.z);
+			glm::vec2 extent = glm::vec2(
+				std::abs(axis_y.y) + std::abs(axis_z.y),
+				std::abs(axis_y.z) + std::abs(axis_z.z)
+			);
+			glm::vec2 center = glm::vec2(object->position.y, object->position.z);
+			bounds[i] = glm::vec4(center - extent, center + extent);
+		}
+	});
+
+	if (objects.empty()) {
+		cells = glm::ivec2(0);
+		cell_start.assign(1, 0);
+		cell_items.clear();
+		return;
+	}
+
+	glm::vec2 min = glm::vec2(bounds[0].x, bounds[0].y);
+	glm::vec2 max = glm::vec2(bounds[0].z, bounds[0].w);
+	std::vector< float > sizes;
+	sizes.reserve(bounds.size());
+	for (auto const &b : bounds) {
+		min = glm::min(min, glm::vec2(b.x, b.y));
+		max = glm::max(max, glm::vec2(b.z, b.w));
+		sizes.emplace_back(std::max(b.z - b.x, b.w - b.y));
+	}
+
+	cell_size = cell_size_;
+	if (cell_size <= 0.0f) {
+		//about twice the median box size, so most boxes land in only a few cells:
+		std::nth_element(sizes.begin(), sizes.begin() + sizes.size() / 2, sizes.end());
+		cell_size = std::max(1.0f, 2.0f * sizes[sizes.size() / 2]);
+	}
+	glm::vec2 span = max - min;
+	while (int64_t(std::floor(span.x / cell_size) + 1) * int64_t(std::floor(span.y / cell_size) + 1) > MaxCells) {
+		cell_size *= 2.0f;
+	}
+	origin = min;
+	cells = glm::ivec2(int32_t(std::floor(span.x / cell_size)) + 1, int32_t(std::floor(span.y / cell_size)) + 1);
+
+	auto cell_range = [&](glm::vec4 const &b, glm::ivec2 *lo, glm::ivec2 *hi) {
+		*lo = glm::clamp(glm::ivec2(glm::floor((glm::vec2(b.x, b.y) - origin) / cell_size)), glm::ivec2(0), cells - 1);
+		*hi = glm::clamp(glm::ivec2(glm::floor((glm::vec2(b.z, b.w) - origin) / cell_size)), glm::ivec2(0), cells - 1);
+	};
+
+	//count, prefix-sum, then fill (objects are added in order, so each cell's list is sorted):
+	cell_start.assign(size_t(cells.x) * size_t(cells.y) + 1, 0);
+	for (auto const &b : bounds) {
+		glm::ivec2 lo, hi;
+		cell_range(b, &lo, &hi);
+		for (int32_t z = lo.y; z <= hi.y; ++z) {
+			for (int32_t y = lo.x; y <= hi.x; ++y) {
+				cell_start[z * cells.x + y + 1] += 1;
+			}
+		}
+	}
+	for (size_t c = 1; c < cell_start.size(); ++c) {
+		cell_start[c] += cell_start[c-1];
+	}
+	cell_items.resize(cell_start.back());
+	std::vector< uint32_t > fill(cell_start.begin(), cell_start.end() - 1);
+	for (uint32_t i = 0; i < uint32_t(bounds.size()); ++i) {
+		glm::ivec2 lo, hi;
+		cell_range(bounds[i], &lo, &hi);
+		for (int32_t z = lo.y; z <= hi.y; ++z) {
+			for (int32_t y = lo.x; y <= hi.x; ++y) {
+				cell_items[fill[z * cells.x + y]++] = i;
+			}
+		}
+	}
+}
+
+void CollisionGrid::query(glm::vec2 const &min, glm::vec2 const &max, std::vector< Scene::Transform * > *out_) const {
+	auto &out = *out_;
+	if (objects.empty()) return;
+
+	glm::vec2 lo_f = glm::floor((min - origin) / cell_size);
+	glm::vec2 hi_f = glm::floor((max - origin) / cell_size);
+	if (hi_f.x < 0.0f || hi_f.y < 0.0f || lo_f.x >= float(cells.x) || lo_f.y >= float(cells.y)) return;
+	glm::ivec2 lo = glm::clamp(glm::ivec2(lo_f), glm::ivec2(0), cells - 1);
+	glm::ivec2 hi = glm::clamp(glm::ivec2(hi_f), glm::ivec2(0), cells - 1);
+
+	//gather candidate indices, then sort + unique to restore build order and drop duplicates:
+	// (small, so a local buffer is fine)
+	uint32_t local[64];
+	std::vector< uint32_t > overflow;
+	uint32_t count = 0;
+	for (int32_t z = lo.y; z <= hi.y; ++z) {
+		for (int32_t y = lo.x; y <= hi.x; ++y) {
+			uint32_t c = z * cells.x + y;
+			for (uint32_t at = cell_start[c]; at < cell_start[c+1]; ++at) {
+				uint32_t i = cell_items[at];
+				glm::vec4 const &b = bounds[i];
+				if (b.z < min.x || b.x > max.x || b.w < min.y || b.y > max.y) continue;
+				if (count < 64) local[count] = i;
+				else {
+					if (overflow.empty()) overflow.assign(local, local + 64);
+					overflow.emplace_back(i);
+				}
+				count += 1;
+			}
+		}
+	}
+
+	uint32_t *begin = (overflow.empty() ? local : overflow.data());
+	uint32_t *end = begin + count;
+	std::sort(begin, end);
+	end = std::unique(begin, end);
+	for (uint32_t *i = begin; i != end; ++i) {
+		out.emplace_back(objects[*i]);
+	}
+}
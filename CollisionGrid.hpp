@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Scene.hpp"
+
+#include <glm/glm.hpp>
+
+#include <initializer_list>
+#include <vector>
+
+// Uniform grid over the (y,z) bounds of a fixed set of collision boxes, so that
+// characters only test the boxes near them instead of scanning every list.
+//
+// Boxes are the same oriented boxes Character::collide uses (half-extents are
+// transform->scale); the grid stores their world-space y-z bounding rectangles.
+// The grid is built once -- call build() again if any of the boxes move.
+
+struct CollisionGrid {
+	// build from lists of boxes; query results come back in this order:
+	// (cell_size of zero picks a size based on the boxes)
+	void build(std::initializer_list< std::vector< Scene::Transform * > const * > lists, float cell_size = 0.0f);
+
+	// append every box whose bounds overlap [min,max] (in the y-z plane) to 'out', in build order, without duplicates:
+	// (const and free of shared scratch state, so it may be called from several threads at once)
+	void query(glm::vec2 const &min, glm::vec2 const &max, std::vector< Scene::Transform * > *out) const;
+
+	std::vector< Scene::Transform * > objects;
+	std::vector< glm::vec4 > bounds; // (min.y, min.z, max.y, max.z) for each object
+
+	float cell_size = 1.0f;
+	glm::vec2 origin = glm::vec2(0.0f); // (y,z) of the corner of cell (0,0)
+	glm::ivec2 cells = glm::ivec2(0); // grid dimensions
+
+	// compressed cell lists: objects in cell c are cell_items[cell_start[c] .. cell_start[c+1]):
+	std::vector< uint32_t > cell_start;
+	std::vector< uint32_t > cell_items;
+};
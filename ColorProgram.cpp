@@ -2,6 +2,7 @@
 
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
+#include "GLState.hpp"
 
 Load< ColorProgram > color_program(LoadTagEarly);
 
@@ -25,7 +26,8 @@ ColorProgram::ColorProgram() {
 		"out vec4 fragColor;\n"
 		"void main() {\n"
 		"	fragColor = color;\n"
-		"}\n"
+		"}\n",
+		"color"
 	);
 	//As you can see above, adjacent strings in C/C++ are concatenated.
 	// this is very useful for writing long shader programs inline.
@@ -39,7 +41,7 @@ ColorProgram::ColorProgram() {
 }
 
 ColorProgram::~ColorProgram() {
-	glDeleteProgram(program);
+	GLState::delete_program(program);
 	program = 0;
 }
 
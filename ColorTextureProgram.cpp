@@ -2,6 +2,7 @@
 
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
+#include "GLState.hpp"
 
 Load< ColorTextureProgram > color_texture_program(LoadTagEarly);
 
@@ -34,7 +35,8 @@ ColorTextureProgram::ColorTextureProgram() {
 		// "	fragColor = vec4(color.rgb, texture(TEX, texCoord).r * color.a);\n"
 	
 		// "	fragColor = vec4(texture(TEX, texCoord).r, texture(TEX, texCoord).g, texture(TEX, texCoord).b, texture(TEX, texCoord).a);\n"
-		"}\n"
+		"}\n",
+		"color_texture"
 	);
 	//As you can see above, adjacent strings in C/C++ are concatenated.
 	// this is very useful for writing long shader programs inline.
@@ -49,15 +51,15 @@ ColorTextureProgram::ColorTextureProgram() {
 	GLuint TEX_sampler2D = glGetUniformLocation(program, "TEX");
 
 	//set TEX to always refer to texture binding zero:
-	glUseProgram(program); //bind program -- glUniform* calls refer to this program now
+	GLState::use_program(program); //bind program -- glUniform* calls refer to this program now
 
 	glUniform1i(TEX_sampler2D, 0); //set TEX to sample from GL_TEXTURE0
 
-	glUseProgram(0); //unbind program -- glUniform* calls refer to ??? now
+	GLState::use_program(0); //unbind program -- glUniform* calls refer to ??? now
 }
 
 ColorTextureProgram::~ColorTextureProgram() {
-	glDeleteProgram(program);
+	GLState::delete_program(program);
 	program = 0;
 }
 
@@ -1,6 +1,7 @@
 #include "DynamicMeshBuffer.hpp"
 
 #include "gl_errors.hpp"
+#include "GLState.hpp"
 
 #include <stdexcept>
 #include <string>
@@ -14,15 +15,15 @@ DynamicMeshBuffer::DynamicMeshBuffer() {
 	glGenBuffers(1, &buffer); 
 	//Now that we have a buffer name, need to bind it to actually create the buffer object:
 	//"No buffer objects are associated with the returned buffer object names until they are first bound by calling glBindBuffer." (https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGenBuffers.xhtml)
-	glBindBuffer(GL_ARRAY_BUFFER, buffer); 
+	GLState::bind_buffer(GL_ARRAY_BUFFER, buffer); 
 	// (but don't have to do anything with it while it is bound)
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
 
 	GL_ERRORS();
 }
 
 DynamicMeshBuffer::~DynamicMeshBuffer() {
-	glDeleteBuffers(1, &buffer);
+	GLState::delete_buffers(1, &buffer);
 	buffer = 0;
 	count = 0;
 
@@ -46,9 +47,9 @@ void DynamicMeshBuffer::set(DynamicMeshBuffer::Vertex const *data, size_t count_
 	//store the count for later:
 	count = (uint32_t)count_;
 
-	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, buffer);
 	glBufferData(GL_ARRAY_BUFFER, count * sizeof(Vertex), data, usage);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
 
 	GL_ERRORS();
 }
@@ -57,8 +58,8 @@ GLuint DynamicMeshBuffer::make_vao_for_program(GLuint program) const {
 	//look up each attribute location in the program and bind it to the buffer with the correct offset and stride:
 	GLuint vao = 0;
 	glGenVertexArrays(1, &vao);
-	glBindVertexArray(vao);
-	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	GLState::bind_vertex_array(vao);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, buffer);
 
 	//keep track of which attributes are bound for debugging purposes:
 	std::set< GLuint > bound;
@@ -96,8 +97,8 @@ GLuint DynamicMeshBuffer::make_vao_for_program(GLuint program) const {
 		}
 	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
+	GLState::bind_vertex_array(0);
 
 
 	//Check that all active attributes were bound:
@@ -1,3 +1,5 @@
+//init_GL and the GL_PROFILE wrappers call the real functions:
+#define GL_PROFILE_NO_REDIRECT
 #include "GL.hpp"
 
 #include <SDL3/SDL.h>
@@ -584,3 +586,2149 @@ void init_GL() {
 	 void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean normalized, GLuint value);
 	 void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 #endif
+
+#ifdef GL_PROFILE
+#include <chrono>
+
+namespace {
+	GLProfileEntry entries[] = {
+		{ "glCullFace", 0, 0, 0 },
+		{ "glFrontFace", 0, 0, 0 },
+		{ "glHint", 0, 0, 0 },
+		{ "glLineWidth", 0, 0, 0 },
+		{ "glPointSize", 0, 0, 0 },
+		{ "glPolygonMode", 0, 0, 0 },
+		{ "glScissor", 0, 0, 0 },
+		{ "glTexParameterf", 0, 0, 0 },
+		{ "glTexParameterfv", 0, 0, 0 },
+		{ "glTexParameteri", 0, 0, 0 },
+		{ "glTexParameteriv", 0, 0, 0 },
+		{ "glTexImage1D", 0, 0, 0 },
+		{ "glTexImage2D", 0, 0, 0 },
+		{ "glDrawBuffer", 0, 0, 0 },
+		{ "glClear", 0, 0, 0 },
+		{ "glClearColor", 0, 0, 0 },
+		{ "glClearStencil", 0, 0, 0 },
+		{ "glClearDepth", 0, 0, 0 },
+		{ "glStencilMask", 0, 0, 0 },
+		{ "glColorMask", 0, 0, 0 },
+		{ "glDepthMask", 0, 0, 0 },
+		{ "glDisable", 0, 0, 0 },
+		{ "glEnable", 0, 0, 0 },
+		{ "glFinish", 0, 0, 0 },
+		{ "glFlush", 0, 0, 0 },
+		{ "glBlendFunc", 0, 0, 0 },
+		{ "glLogicOp", 0, 0, 0 },
+		{ "glStencilFunc", 0, 0, 0 },
+		{ "glStencilOp", 0, 0, 0 },
+		{ "glDepthFunc", 0, 0, 0 },
+		{ "glPixelStoref", 0, 0, 0 },
+		{ "glPixelStorei", 0, 0, 0 },
+		{ "glReadBuffer", 0, 0, 0 },
+		{ "glReadPixels", 0, 0, 0 },
+		{ "glGetBooleanv", 0, 0, 0 },
+		{ "glGetDoublev", 0, 0, 0 },
+		{ "glGetError", 0, 0, 0 },
+		{ "glGetFloatv", 0, 0, 0 },
+		{ "glGetIntegerv", 0, 0, 0 },
+		{ "glGetString", 0, 0, 0 },
+		{ "glGetTexImage", 0, 0, 0 },
+		{ "glGetTexParameterfv", 0, 0, 0 },
+		{ "glGetTexParameteriv", 0, 0, 0 },
+		{ "glGetTexLevelParameterfv", 0, 0, 0 },
+		{ "glGetTexLevelParameteriv", 0, 0, 0 },
+		{ "glIsEnabled", 0, 0, 0 },
+		{ "glDepthRange", 0, 0, 0 },
+		{ "glViewport", 0, 0, 0 },
+		{ "glDrawArrays", 0, 0, 0 },
+		{ "glDrawElements", 0, 0, 0 },
+		{ "glGetPointerv", 0, 0, 0 },
+		{ "glPolygonOffset", 0, 0, 0 },
+		{ "glCopyTexImage1D", 0, 0, 0 },
+		{ "glCopyTexImage2D", 0, 0, 0 },
+		{ "glCopyTexSubImage1D", 0, 0, 0 },
+		{ "glCopyTexSubImage2D", 0, 0, 0 },
+		{ "glTexSubImage1D", 0, 0, 0 },
+		{ "glTexSubImage2D", 0, 0, 0 },
+		{ "glBindTexture", 0, 0, 0 },
+		{ "glDeleteTextures", 0, 0, 0 },
+		{ "glGenTextures", 0, 0, 0 },
+		{ "glIsTexture", 0, 0, 0 },
+		{ "glDrawRangeElements", 0, 0, 0 },
+		{ "glTexImage3D", 0, 0, 0 },
+		{ "glTexSubImage3D", 0, 0, 0 },
+		{ "glCopyTexSubImage3D", 0, 0, 0 },
+		{ "glActiveTexture", 0, 0, 0 },
+		{ "glSampleCoverage", 0, 0, 0 },
+		{ "glCompressedTexImage3D", 0, 0, 0 },
+		{ "glCompressedTexImage2D", 0, 0, 0 },
+		{ "glCompressedTexImage1D", 0, 0, 0 },
+		{ "glCompressedTexSubImage3D", 0, 0, 0 },
+		{ "glCompressedTexSubImage2D", 0, 0, 0 },
+		{ "glCompressedTexSubImage1D", 0, 0, 0 },
+		{ "glGetCompressedTexImage", 0, 0, 0 },
+		{ "glBlendFuncSeparate", 0, 0, 0 },
+		{ "glMultiDrawArrays", 0, 0, 0 },
+		{ "glMultiDrawElements", 0, 0, 0 },
+		{ "glPointParameterf", 0, 0, 0 },
+		{ "glPointParameterfv", 0, 0, 0 },
+		{ "glPointParameteri", 0, 0, 0 },
+		{ "glPointParameteriv", 0, 0, 0 },
+		{ "glBlendColor", 0, 0, 0 },
+		{ "glBlendEquation", 0, 0, 0 },
+		{ "glGenQueries", 0, 0, 0 },
+		{ "glDeleteQueries", 0, 0, 0 },
+		{ "glIsQuery", 0, 0, 0 },
+		{ "glBeginQuery", 0, 0, 0 },
+		{ "glEndQuery", 0, 0, 0 },
+		{ "glGetQueryiv", 0, 0, 0 },
+		{ "glGetQueryObjectiv", 0, 0, 0 },
+		{ "glGetQueryObjectuiv", 0, 0, 0 },
+		{ "glBindBuffer", 0, 0, 0 },
+		{ "glDeleteBuffers", 0, 0, 0 },
+		{ "glGenBuffers", 0, 0, 0 },
+		{ "glIsBuffer", 0, 0, 0 },
+		{ "glBufferData", 0, 0, 0 },
+		{ "glBufferSubData", 0, 0, 0 },
+		{ "glGetBufferSubData", 0, 0, 0 },
+		{ "glMapBuffer", 0, 0, 0 },
+		{ "glUnmapBuffer", 0, 0, 0 },
+		{ "glGetBufferParameteriv", 0, 0, 0 },
+		{ "glGetBufferPointerv", 0, 0, 0 },
+		{ "glBlendEquationSeparate", 0, 0, 0 },
+		{ "glDrawBuffers", 0, 0, 0 },
+		{ "glStencilOpSeparate", 0, 0, 0 },
+		{ "glStencilFuncSeparate", 0, 0, 0 },
+		{ "glStencilMaskSeparate", 0, 0, 0 },
+		{ "glAttachShader", 0, 0, 0 },
+		{ "glBindAttribLocation", 0, 0, 0 },
+		{ "glCompileShader", 0, 0, 0 },
+		{ "glCreateProgram", 0, 0, 0 },
+		{ "glCreateShader", 0, 0, 0 },
+		{ "glDeleteProgram", 0, 0, 0 },
+		{ "glDeleteShader", 0, 0, 0 },
+		{ "glDetachShader", 0, 0, 0 },
+		{ "glDisableVertexAttribArray", 0, 0, 0 },
+		{ "glEnableVertexAttribArray", 0, 0, 0 },
+		{ "glGetActiveAttrib", 0, 0, 0 },
+		{ "glGetActiveUniform", 0, 0, 0 },
+		{ "glGetAttachedShaders", 0, 0, 0 },
+		{ "glGetAttribLocation", 0, 0, 0 },
+		{ "glGetProgramiv", 0, 0, 0 },
+		{ "glGetProgramInfoLog", 0, 0, 0 },
+		{ "glGetShaderiv", 0, 0, 0 },
+		{ "glGetShaderInfoLog", 0, 0, 0 },
+		{ "glGetShaderSource", 0, 0, 0 },
+		{ "glGetUniformLocation", 0, 0, 0 },
+		{ "glGetUniformfv", 0, 0, 0 },
+		{ "glGetUniformiv", 0, 0, 0 },
+		{ "glGetVertexAttribdv", 0, 0, 0 },
+		{ "glGetVertexAttribfv", 0, 0, 0 },
+		{ "glGetVertexAttribiv", 0, 0, 0 },
+		{ "glGetVertexAttribPointerv", 0, 0, 0 },
+		{ "glIsProgram", 0, 0, 0 },
+		{ "glIsShader", 0, 0, 0 },
+		{ "glLinkProgram", 0, 0, 0 },
+		{ "glShaderSource", 0, 0, 0 },
+		{ "glUseProgram", 0, 0, 0 },
+		{ "glUniform1f", 0, 0, 0 },
+		{ "glUniform2f", 0, 0, 0 },
+		{ "glUniform3f", 0, 0, 0 },
+		{ "glUniform4f", 0, 0, 0 },
+		{ "glUniform1i", 0, 0, 0 },
+		{ "glUniform2i", 0, 0, 0 },
+		{ "glUniform3i", 0, 0, 0 },
+		{ "glUniform4i", 0, 0, 0 },
+		{ "glUniform1fv", 0, 0, 0 },
+		{ "glUniform2fv", 0, 0, 0 },
+		{ "glUniform3fv", 0, 0, 0 },
+		{ "glUniform4fv", 0, 0, 0 },
+		{ "glUniform1iv", 0, 0, 0 },
+		{ "glUniform2iv", 0, 0, 0 },
+		{ "glUniform3iv", 0, 0, 0 },
+		{ "glUniform4iv", 0, 0, 0 },
+		{ "glUniformMatrix2fv", 0, 0, 0 },
+		{ "glUniformMatrix3fv", 0, 0, 0 },
+		{ "glUniformMatrix4fv", 0, 0, 0 },
+		{ "glValidateProgram", 0, 0, 0 },
+		{ "glVertexAttrib1d", 0, 0, 0 },
+		{ "glVertexAttrib1dv", 0, 0, 0 },
+		{ "glVertexAttrib1f", 0, 0, 0 },
+		{ "glVertexAttrib1fv", 0, 0, 0 },
+		{ "glVertexAttrib1s", 0, 0, 0 },
+		{ "glVertexAttrib1sv", 0, 0, 0 },
+		{ "glVertexAttrib2d", 0, 0, 0 },
+		{ "glVertexAttrib2dv", 0, 0, 0 },
+		{ "glVertexAttrib2f", 0, 0, 0 },
+		{ "glVertexAttrib2fv", 0, 0, 0 },
+		{ "glVertexAttrib2s", 0, 0, 0 },
+		{ "glVertexAttrib2sv", 0, 0, 0 },
+		{ "glVertexAttrib3d", 0, 0, 0 },
+		{ "glVertexAttrib3dv", 0, 0, 0 },
+		{ "glVertexAttrib3f", 0, 0, 0 },
+		{ "glVertexAttrib3fv", 0, 0, 0 },
+		{ "glVertexAttrib3s", 0, 0, 0 },
+		{ "glVertexAttrib3sv", 0, 0, 0 },
+		{ "glVertexAttrib4Nbv", 0, 0, 0 },
+		{ "glVertexAttrib4Niv", 0, 0, 0 },
+		{ "glVertexAttrib4Nsv", 0, 0, 0 },
+		{ "glVertexAttrib4Nub", 0, 0, 0 },
+		{ "glVertexAttrib4Nubv", 0, 0, 0 },
+		{ "glVertexAttrib4Nuiv", 0, 0, 0 },
+		{ "glVertexAttrib4Nusv", 0, 0, 0 },
+		{ "glVertexAttrib4bv", 0, 0, 0 },
+		{ "glVertexAttrib4d", 0, 0, 0 },
+		{ "glVertexAttrib4dv", 0, 0, 0 },
+		{ "glVertexAttrib4f", 0, 0, 0 },
+		{ "glVertexAttrib4fv", 0, 0, 0 },
+		{ "glVertexAttrib4iv", 0, 0, 0 },
+		{ "glVertexAttrib4s", 0, 0, 0 },
+		{ "glVertexAttrib4sv", 0, 0, 0 },
+		{ "glVertexAttrib4ubv", 0, 0, 0 },
+		{ "glVertexAttrib4uiv", 0, 0, 0 },
+		{ "glVertexAttrib4usv", 0, 0, 0 },
+		{ "glVertexAttribPointer", 0, 0, 0 },
+		{ "glUniformMatrix2x3fv", 0, 0, 0 },
+		{ "glUniformMatrix3x2fv", 0, 0, 0 },
+		{ "glUniformMatrix2x4fv", 0, 0, 0 },
+		{ "glUniformMatrix4x2fv", 0, 0, 0 },
+		{ "glUniformMatrix3x4fv", 0, 0, 0 },
+		{ "glUniformMatrix4x3fv", 0, 0, 0 },
+		{ "glColorMaski", 0, 0, 0 },
+		{ "glGetBooleani_v", 0, 0, 0 },
+		{ "glGetIntegeri_v", 0, 0, 0 },
+		{ "glEnablei", 0, 0, 0 },
+		{ "glDisablei", 0, 0, 0 },
+		{ "glIsEnabledi", 0, 0, 0 },
+		{ "glBeginTransformFeedback", 0, 0, 0 },
+		{ "glEndTransformFeedback", 0, 0, 0 },
+		{ "glBindBufferRange", 0, 0, 0 },
+		{ "glBindBufferBase", 0, 0, 0 },
+		{ "glTransformFeedbackVaryings", 0, 0, 0 },
+		{ "glGetTransformFeedbackVarying", 0, 0, 0 },
+		{ "glClampColor", 0, 0, 0 },
+		{ "glBeginConditionalRender", 0, 0, 0 },
+		{ "glEndConditionalRender", 0, 0, 0 },
+		{ "glVertexAttribIPointer", 0, 0, 0 },
+		{ "glGetVertexAttribIiv", 0, 0, 0 },
+		{ "glGetVertexAttribIuiv", 0, 0, 0 },
+		{ "glVertexAttribI1i", 0, 0, 0 },
+		{ "glVertexAttribI2i", 0, 0, 0 },
+		{ "glVertexAttribI3i", 0, 0, 0 },
+		{ "glVertexAttribI4i", 0, 0, 0 },
+		{ "glVertexAttribI1ui", 0, 0, 0 },
+		{ "glVertexAttribI2ui", 0, 0, 0 },
+		{ "glVertexAttribI3ui", 0, 0, 0 },
+		{ "glVertexAttribI4ui", 0, 0, 0 },
+		{ "glVertexAttribI1iv", 0, 0, 0 },
+		{ "glVertexAttribI2iv", 0, 0, 0 },
+		{ "glVertexAttribI3iv", 0, 0, 0 },
+		{ "glVertexAttribI4iv", 0, 0, 0 },
+		{ "glVertexAttribI1uiv", 0, 0, 0 },
+		{ "glVertexAttribI2uiv", 0, 0, 0 },
+		{ "glVertexAttribI3uiv", 0, 0, 0 },
+		{ "glVertexAttribI4uiv", 0, 0, 0 },
+		{ "glVertexAttribI4bv", 0, 0, 0 },
+		{ "glVertexAttribI4sv", 0, 0, 0 },
+		{ "glVertexAttribI4ubv", 0, 0, 0 },
+		{ "glVertexAttribI4usv", 0, 0, 0 },
+		{ "glGetUniformuiv", 0, 0, 0 },
+		{ "glBindFragDataLocation", 0, 0, 0 },
+		{ "glGetFragDataLocation", 0, 0, 0 },
+		{ "glUniform1ui", 0, 0, 0 },
+		{ "glUniform2ui", 0, 0, 0 },
+		{ "glUniform3ui", 0, 0, 0 },
+		{ "glUniform4ui", 0, 0, 0 },
+		{ "glUniform1uiv", 0, 0, 0 },
+		{ "glUniform2uiv", 0, 0, 0 },
+		{ "glUniform3uiv", 0, 0, 0 },
+		{ "glUniform4uiv", 0, 0, 0 },
+		{ "glTexParameterIiv", 0, 0, 0 },
+		{ "glTexParameterIuiv", 0, 0, 0 },
+		{ "glGetTexParameterIiv", 0, 0, 0 },
+		{ "glGetTexParameterIuiv", 0, 0, 0 },
+		{ "glClearBufferiv", 0, 0, 0 },
+		{ "glClearBufferuiv", 0, 0, 0 },
+		{ "glClearBufferfv", 0, 0, 0 },
+		{ "glClearBufferfi", 0, 0, 0 },
+		{ "glGetStringi", 0, 0, 0 },
+		{ "glIsRenderbuffer", 0, 0, 0 },
+		{ "glBindRenderbuffer", 0, 0, 0 },
+		{ "glDeleteRenderbuffers", 0, 0, 0 },
+		{ "glGenRenderbuffers", 0, 0, 0 },
+		{ "glRenderbufferStorage", 0, 0, 0 },
+		{ "glGetRenderbufferParameteriv", 0, 0, 0 },
+		{ "glIsFramebuffer", 0, 0, 0 },
+		{ "glBindFramebuffer", 0, 0, 0 },
+		{ "glDeleteFramebuffers", 0, 0, 0 },
+		{ "glGenFramebuffers", 0, 0, 0 },
+		{ "glCheckFramebufferStatus", 0, 0, 0 },
+		{ "glFramebufferTexture1D", 0, 0, 0 },
+		{ "glFramebufferTexture2D", 0, 0, 0 },
+		{ "glFramebufferTexture3D", 0, 0, 0 },
+		{ "glFramebufferRenderbuffer", 0, 0, 0 },
+		{ "glGetFramebufferAttachmentParameteriv", 0, 0, 0 },
+		{ "glGenerateMipmap", 0, 0, 0 },
+		{ "glBlitFramebuffer", 0, 0, 0 },
+		{ "glRenderbufferStorageMultisample", 0, 0, 0 },
+		{ "glFramebufferTextureLayer", 0, 0, 0 },
+		{ "glMapBufferRange", 0, 0, 0 },
+		{ "glFlushMappedBufferRange", 0, 0, 0 },
+		{ "glBindVertexArray", 0, 0, 0 },
+		{ "glDeleteVertexArrays", 0, 0, 0 },
+		{ "glGenVertexArrays", 0, 0, 0 },
+		{ "glIsVertexArray", 0, 0, 0 },
+		{ "glDrawArraysInstanced", 0, 0, 0 },
+		{ "glDrawElementsInstanced", 0, 0, 0 },
+		{ "glTexBuffer", 0, 0, 0 },
+		{ "glPrimitiveRestartIndex", 0, 0, 0 },
+		{ "glCopyBufferSubData", 0, 0, 0 },
+		{ "glGetUniformIndices", 0, 0, 0 },
+		{ "glGetActiveUniformsiv", 0, 0, 0 },
+		{ "glGetActiveUniformName", 0, 0, 0 },
+		{ "glGetUniformBlockIndex", 0, 0, 0 },
+		{ "glGetActiveUniformBlockiv", 0, 0, 0 },
+		{ "glGetActiveUniformBlockName", 0, 0, 0 },
+		{ "glUniformBlockBinding", 0, 0, 0 },
+		{ "glDrawElementsBaseVertex", 0, 0, 0 },
+		{ "glDrawRangeElementsBaseVertex", 0, 0, 0 },
+		{ "glDrawElementsInstancedBaseVertex", 0, 0, 0 },
+		{ "glMultiDrawElementsBaseVertex", 0, 0, 0 },
+		{ "glProvokingVertex", 0, 0, 0 },
+		{ "glFenceSync", 0, 0, 0 },
+		{ "glIsSync", 0, 0, 0 },
+		{ "glDeleteSync", 0, 0, 0 },
+		{ "glClientWaitSync", 0, 0, 0 },
+		{ "glWaitSync", 0, 0, 0 },
+		{ "glGetInteger64v", 0, 0, 0 },
+		{ "glGetSynciv", 0, 0, 0 },
+		{ "glGetInteger64i_v", 0, 0, 0 },
+		{ "glGetBufferParameteri64v", 0, 0, 0 },
+		{ "glFramebufferTexture", 0, 0, 0 },
+		{ "glTexImage2DMultisample", 0, 0, 0 },
+		{ "glTexImage3DMultisample", 0, 0, 0 },
+		{ "glGetMultisamplefv", 0, 0, 0 },
+		{ "glSampleMaski", 0, 0, 0 },
+		{ "glBindFragDataLocationIndexed", 0, 0, 0 },
+		{ "glGetFragDataIndex", 0, 0, 0 },
+		{ "glGenSamplers", 0, 0, 0 },
+		{ "glDeleteSamplers", 0, 0, 0 },
+		{ "glIsSampler", 0, 0, 0 },
+		{ "glBindSampler", 0, 0, 0 },
+		{ "glSamplerParameteri", 0, 0, 0 },
+		{ "glSamplerParameteriv", 0, 0, 0 },
+		{ "glSamplerParameterf", 0, 0, 0 },
+		{ "glSamplerParameterfv", 0, 0, 0 },
+		{ "glSamplerParameterIiv", 0, 0, 0 },
+		{ "glSamplerParameterIuiv", 0, 0, 0 },
+		{ "glGetSamplerParameteriv", 0, 0, 0 },
+		{ "glGetSamplerParameterIiv", 0, 0, 0 },
+		{ "glGetSamplerParameterfv", 0, 0, 0 },
+		{ "glGetSamplerParameterIuiv", 0, 0, 0 },
+		{ "glQueryCounter", 0, 0, 0 },
+		{ "glGetQueryObjecti64v", 0, 0, 0 },
+		{ "glGetQueryObjectui64v", 0, 0, 0 },
+		{ "glVertexAttribDivisor", 0, 0, 0 },
+		{ "glVertexAttribP1ui", 0, 0, 0 },
+		{ "glVertexAttribP1uiv", 0, 0, 0 },
+		{ "glVertexAttribP2ui", 0, 0, 0 },
+		{ "glVertexAttribP2uiv", 0, 0, 0 },
+		{ "glVertexAttribP3ui", 0, 0, 0 },
+		{ "glVertexAttribP3uiv", 0, 0, 0 },
+		{ "glVertexAttribP4ui", 0, 0, 0 },
+		{ "glVertexAttribP4uiv", 0, 0, 0 },
+	};
+
+	//counts a call (and the time until the end of the enclosing block):
+	struct Timed {
+		Timed(GLProfileEntry &entry_, uint64_t bytes = 0) : entry(entry_), start(std::chrono::steady_clock::now()) {
+			entry.bytes += bytes;
+		}
+		~Timed() {
+			entry.calls += 1;
+			entry.nanoseconds += uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+		}
+		GLProfileEntry &entry;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	//size of a block of client-memory pixels (ignoring GL_UNPACK_ROW_LENGTH / GL_UNPACK_ALIGNMENT padding):
+	uint64_t pixel_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth) {
+		uint64_t pixels = uint64_t(width) * uint64_t(height) * uint64_t(depth);
+		switch (type) {
+			case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+				return pixels;
+			case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+			case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+			case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+				return pixels * 2;
+			case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+			case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+			case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+				return pixels * 4;
+			case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+				return pixels * 8;
+			default: break;
+		}
+		uint64_t components = 4;
+		switch (format) {
+			case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER: case GL_GREEN_INTEGER: case GL_BLUE_INTEGER:
+			case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+				components = 1; break;
+			case GL_RG: case GL_RG_INTEGER:
+				components = 2; break;
+			case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+				components = 3; break;
+			default: break;
+		}
+		uint64_t component_bytes = 1;
+		switch (type) {
+			case GL_SHORT: case GL_UNSIGNED_SHORT: case GL_HALF_FLOAT:
+				component_bytes = 2; break;
+			case GL_INT: case GL_UNSIGNED_INT: case GL_FLOAT:
+				component_bytes = 4; break;
+			default: break;
+		}
+		return pixels * components * component_bytes;
+	}
+}
+
+GLProfileEntry *gl_profile_entries(size_t *count) {
+	*count = sizeof(entries) / sizeof(entries[0]);
+	return entries;
+}
+
+void gl_profile_reset() {
+	for (auto &entry : entries) {
+		entry.calls = 0;
+		entry.bytes = 0;
+		entry.nanoseconds = 0;
+	}
+}
+
+void gl_profile_glCullFace(GLenum mode) {
+	Timed timed(entries[0]);
+	glCullFace(mode);
+}
+
+void gl_profile_glFrontFace(GLenum mode) {
+	Timed timed(entries[1]);
+	glFrontFace(mode);
+}
+
+void gl_profile_glHint(GLenum target, GLenum mode) {
+	Timed timed(entries[2]);
+	glHint(target, mode);
+}
+
+void gl_profile_glLineWidth(GLfloat width) {
+	Timed timed(entries[3]);
+	glLineWidth(width);
+}
+
+void gl_profile_glPointSize(GLfloat size) {
+	Timed timed(entries[4]);
+	glPointSize(size);
+}
+
+void gl_profile_glPolygonMode(GLenum face, GLenum mode) {
+	Timed timed(entries[5]);
+	glPolygonMode(face, mode);
+}
+
+void gl_profile_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	Timed timed(entries[6]);
+	glScissor(x, y, width, height);
+}
+
+void gl_profile_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	Timed timed(entries[7]);
+	glTexParameterf(target, pname, param);
+}
+
+void gl_profile_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	Timed timed(entries[8]);
+	glTexParameterfv(target, pname, params);
+}
+
+void gl_profile_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	Timed timed(entries[9]);
+	glTexParameteri(target, pname, param);
+}
+
+void gl_profile_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	Timed timed(entries[10]);
+	glTexParameteriv(target, pname, params);
+}
+
+void gl_profile_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	Timed timed(entries[11]);
+	glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+void gl_profile_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	Timed timed(entries[12], (pixels ? pixel_bytes(format, type, width, height, 1) : 0));
+	glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+void gl_profile_glDrawBuffer(GLenum buf) {
+	Timed timed(entries[13]);
+	glDrawBuffer(buf);
+}
+
+void gl_profile_glClear(GLbitfield mask) {
+	Timed timed(entries[14]);
+	glClear(mask);
+}
+
+void gl_profile_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	Timed timed(entries[15]);
+	glClearColor(red, green, blue, alpha);
+}
+
+void gl_profile_glClearStencil(GLint s) {
+	Timed timed(entries[16]);
+	glClearStencil(s);
+}
+
+void gl_profile_glClearDepth(GLdouble depth) {
+	Timed timed(entries[17]);
+	glClearDepth(depth);
+}
+
+void gl_profile_glStencilMask(GLuint mask) {
+	Timed timed(entries[18]);
+	glStencilMask(mask);
+}
+
+void gl_profile_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	Timed timed(entries[19]);
+	glColorMask(red, green, blue, alpha);
+}
+
+void gl_profile_glDepthMask(GLboolean flag) {
+	Timed timed(entries[20]);
+	glDepthMask(flag);
+}
+
+void gl_profile_glDisable(GLenum cap) {
+	Timed timed(entries[21]);
+	glDisable(cap);
+}
+
+void gl_profile_glEnable(GLenum cap) {
+	Timed timed(entries[22]);
+	glEnable(cap);
+}
+
+void gl_profile_glFinish(void) {
+	Timed timed(entries[23]);
+	glFinish();
+}
+
+void gl_profile_glFlush(void) {
+	Timed timed(entries[24]);
+	glFlush();
+}
+
+void gl_profile_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	Timed timed(entries[25]);
+	glBlendFunc(sfactor, dfactor);
+}
+
+void gl_profile_glLogicOp(GLenum opcode) {
+	Timed timed(entries[26]);
+	glLogicOp(opcode);
+}
+
+void gl_profile_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	Timed timed(entries[27]);
+	glStencilFunc(func, ref, mask);
+}
+
+void gl_profile_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	Timed timed(entries[28]);
+	glStencilOp(fail, zfail, zpass);
+}
+
+void gl_profile_glDepthFunc(GLenum func) {
+	Timed timed(entries[29]);
+	glDepthFunc(func);
+}
+
+void gl_profile_glPixelStoref(GLenum pname, GLfloat param) {
+	Timed timed(entries[30]);
+	glPixelStoref(pname, param);
+}
+
+void gl_profile_glPixelStorei(GLenum pname, GLint param) {
+	Timed timed(entries[31]);
+	glPixelStorei(pname, param);
+}
+
+void gl_profile_glReadBuffer(GLenum src) {
+	Timed timed(entries[32]);
+	glReadBuffer(src);
+}
+
+void gl_profile_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	Timed timed(entries[33]);
+	glReadPixels(x, y, width, height, format, type, pixels);
+}
+
+void gl_profile_glGetBooleanv(GLenum pname, GLboolean *data) {
+	Timed timed(entries[34]);
+	glGetBooleanv(pname, data);
+}
+
+void gl_profile_glGetDoublev(GLenum pname, GLdouble *data) {
+	Timed timed(entries[35]);
+	glGetDoublev(pname, data);
+}
+
+GLenum gl_profile_glGetError(void) {
+	Timed timed(entries[36]);
+	return glGetError();
+}
+
+void gl_profile_glGetFloatv(GLenum pname, GLfloat *data) {
+	Timed timed(entries[37]);
+	glGetFloatv(pname, data);
+}
+
+void gl_profile_glGetIntegerv(GLenum pname, GLint *data) {
+	Timed timed(entries[38]);
+	glGetIntegerv(pname, data);
+}
+
+const GLubyte *gl_profile_glGetString(GLenum name) {
+	Timed timed(entries[39]);
+	return glGetString(name);
+}
+
+void gl_profile_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	Timed timed(entries[40]);
+	glGetTexImage(target, level, format, type, pixels);
+}
+
+void gl_profile_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	Timed timed(entries[41]);
+	glGetTexParameterfv(target, pname, params);
+}
+
+void gl_profile_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	Timed timed(entries[42]);
+	glGetTexParameteriv(target, pname, params);
+}
+
+void gl_profile_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	Timed timed(entries[43]);
+	glGetTexLevelParameterfv(target, level, pname, params);
+}
+
+void gl_profile_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	Timed timed(entries[44]);
+	glGetTexLevelParameteriv(target, level, pname, params);
+}
+
+GLboolean gl_profile_glIsEnabled(GLenum cap) {
+	Timed timed(entries[45]);
+	return glIsEnabled(cap);
+}
+
+void gl_profile_glDepthRange(GLdouble n, GLdouble f) {
+	Timed timed(entries[46]);
+	glDepthRange(n, f);
+}
+
+void gl_profile_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	Timed timed(entries[47]);
+	glViewport(x, y, width, height);
+}
+
+void gl_profile_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	Timed timed(entries[48]);
+	glDrawArrays(mode, first, count);
+}
+
+void gl_profile_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	Timed timed(entries[49]);
+	glDrawElements(mode, count, type, indices);
+}
+
+void gl_profile_glGetPointerv(GLenum pname, void **params) {
+	Timed timed(entries[50]);
+	glGetPointerv(pname, params);
+}
+
+void gl_profile_glPolygonOffset(GLfloat factor, GLfloat units) {
+	Timed timed(entries[51]);
+	glPolygonOffset(factor, units);
+}
+
+void gl_profile_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	Timed timed(entries[52]);
+	glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+void gl_profile_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	Timed timed(entries[53]);
+	glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+void gl_profile_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	Timed timed(entries[54]);
+	glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+void gl_profile_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	Timed timed(entries[55]);
+	glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+void gl_profile_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	Timed timed(entries[56]);
+	glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+void gl_profile_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	Timed timed(entries[57], (pixels ? pixel_bytes(format, type, width, height, 1) : 0));
+	glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+void gl_profile_glBindTexture(GLenum target, GLuint texture) {
+	Timed timed(entries[58]);
+	glBindTexture(target, texture);
+}
+
+void gl_profile_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	Timed timed(entries[59]);
+	glDeleteTextures(n, textures);
+}
+
+void gl_profile_glGenTextures(GLsizei n, GLuint *textures) {
+	Timed timed(entries[60]);
+	glGenTextures(n, textures);
+}
+
+GLboolean gl_profile_glIsTexture(GLuint texture) {
+	Timed timed(entries[61]);
+	return glIsTexture(texture);
+}
+
+void gl_profile_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	Timed timed(entries[62]);
+	glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+void gl_profile_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	Timed timed(entries[63], (pixels ? pixel_bytes(format, type, width, height, depth) : 0));
+	glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+void gl_profile_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	Timed timed(entries[64], (pixels ? pixel_bytes(format, type, width, height, depth) : 0));
+	glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+void gl_profile_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	Timed timed(entries[65]);
+	glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+void gl_profile_glActiveTexture(GLenum texture) {
+	Timed timed(entries[66]);
+	glActiveTexture(texture);
+}
+
+void gl_profile_glSampleCoverage(GLfloat value, GLboolean invert) {
+	Timed timed(entries[67]);
+	glSampleCoverage(value, invert);
+}
+
+void gl_profile_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	Timed timed(entries[68]);
+	glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+void gl_profile_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	Timed timed(entries[69]);
+	glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+void gl_profile_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	Timed timed(entries[70]);
+	glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+
+void gl_profile_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	Timed timed(entries[71]);
+	glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+void gl_profile_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	Timed timed(entries[72]);
+	glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+void gl_profile_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	Timed timed(entries[73]);
+	glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+void gl_profile_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	Timed timed(entries[74]);
+	glGetCompressedTexImage(target, level, img);
+}
+
+void gl_profile_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	Timed timed(entries[75]);
+	glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+void gl_profile_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	Timed timed(entries[76]);
+	glMultiDrawArrays(mode, first, count, drawcount);
+}
+
+void gl_profile_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	Timed timed(entries[77]);
+	glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+
+void gl_profile_glPointParameterf(GLenum pname, GLfloat param) {
+	Timed timed(entries[78]);
+	glPointParameterf(pname, param);
+}
+
+void gl_profile_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	Timed timed(entries[79]);
+	glPointParameterfv(pname, params);
+}
+
+void gl_profile_glPointParameteri(GLenum pname, GLint param) {
+	Timed timed(entries[80]);
+	glPointParameteri(pname, param);
+}
+
+void gl_profile_glPointParameteriv(GLenum pname, const GLint *params) {
+	Timed timed(entries[81]);
+	glPointParameteriv(pname, params);
+}
+
+void gl_profile_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	Timed timed(entries[82]);
+	glBlendColor(red, green, blue, alpha);
+}
+
+void gl_profile_glBlendEquation(GLenum mode) {
+	Timed timed(entries[83]);
+	glBlendEquation(mode);
+}
+
+void gl_profile_glGenQueries(GLsizei n, GLuint *ids) {
+	Timed timed(entries[84]);
+	glGenQueries(n, ids);
+}
+
+void gl_profile_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	Timed timed(entries[85]);
+	glDeleteQueries(n, ids);
+}
+
+GLboolean gl_profile_glIsQuery(GLuint id) {
+	Timed timed(entries[86]);
+	return glIsQuery(id);
+}
+
+void gl_profile_glBeginQuery(GLenum target, GLuint id) {
+	Timed timed(entries[87]);
+	glBeginQuery(target, id);
+}
+
+void gl_profile_glEndQuery(GLenum target) {
+	Timed timed(entries[88]);
+	glEndQuery(target);
+}
+
+void gl_profile_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	Timed timed(entries[89]);
+	glGetQueryiv(target, pname, params);
+}
+
+void gl_profile_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	Timed timed(entries[90]);
+	glGetQueryObjectiv(id, pname, params);
+}
+
+void gl_profile_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	Timed timed(entries[91]);
+	glGetQueryObjectuiv(id, pname, params);
+}
+
+void gl_profile_glBindBuffer(GLenum target, GLuint buffer) {
+	Timed timed(entries[92]);
+	glBindBuffer(target, buffer);
+}
+
+void gl_profile_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	Timed timed(entries[93]);
+	glDeleteBuffers(n, buffers);
+}
+
+void gl_profile_glGenBuffers(GLsizei n, GLuint *buffers) {
+	Timed timed(entries[94]);
+	glGenBuffers(n, buffers);
+}
+
+GLboolean gl_profile_glIsBuffer(GLuint buffer) {
+	Timed timed(entries[95]);
+	return glIsBuffer(buffer);
+}
+
+void gl_profile_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	Timed timed(entries[96], (data ? uint64_t(size) : 0));
+	glBufferData(target, size, data, usage);
+}
+
+void gl_profile_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	Timed timed(entries[97], (data ? uint64_t(size) : 0));
+	glBufferSubData(target, offset, size, data);
+}
+
+void gl_profile_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	Timed timed(entries[98]);
+	glGetBufferSubData(target, offset, size, data);
+}
+
+void *gl_profile_glMapBuffer(GLenum target, GLenum access) {
+	Timed timed(entries[99]);
+	return glMapBuffer(target, access);
+}
+
+GLboolean gl_profile_glUnmapBuffer(GLenum target) {
+	Timed timed(entries[100]);
+	return glUnmapBuffer(target);
+}
+
+void gl_profile_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	Timed timed(entries[101]);
+	glGetBufferParameteriv(target, pname, params);
+}
+
+void gl_profile_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	Timed timed(entries[102]);
+	glGetBufferPointerv(target, pname, params);
+}
+
+void gl_profile_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	Timed timed(entries[103]);
+	glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+void gl_profile_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	Timed timed(entries[104]);
+	glDrawBuffers(n, bufs);
+}
+
+void gl_profile_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	Timed timed(entries[105]);
+	glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+void gl_profile_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	Timed timed(entries[106]);
+	glStencilFuncSeparate(face, func, ref, mask);
+}
+
+void gl_profile_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	Timed timed(entries[107]);
+	glStencilMaskSeparate(face, mask);
+}
+
+void gl_profile_glAttachShader(GLuint program, GLuint shader) {
+	Timed timed(entries[108]);
+	glAttachShader(program, shader);
+}
+
+void gl_profile_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	Timed timed(entries[109]);
+	glBindAttribLocation(program, index, name);
+}
+
+void gl_profile_glCompileShader(GLuint shader) {
+	Timed timed(entries[110]);
+	glCompileShader(shader);
+}
+
+GLuint gl_profile_glCreateProgram(void) {
+	Timed timed(entries[111]);
+	return glCreateProgram();
+}
+
+GLuint gl_profile_glCreateShader(GLenum type) {
+	Timed timed(entries[112]);
+	return glCreateShader(type);
+}
+
+void gl_profile_glDeleteProgram(GLuint program) {
+	Timed timed(entries[113]);
+	glDeleteProgram(program);
+}
+
+void gl_profile_glDeleteShader(GLuint shader) {
+	Timed timed(entries[114]);
+	glDeleteShader(shader);
+}
+
+void gl_profile_glDetachShader(GLuint program, GLuint shader) {
+	Timed timed(entries[115]);
+	glDetachShader(program, shader);
+}
+
+void gl_profile_glDisableVertexAttribArray(GLuint index) {
+	Timed timed(entries[116]);
+	glDisableVertexAttribArray(index);
+}
+
+void gl_profile_glEnableVertexAttribArray(GLuint index) {
+	Timed timed(entries[117]);
+	glEnableVertexAttribArray(index);
+}
+
+void gl_profile_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	Timed timed(entries[118]);
+	glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+void gl_profile_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	Timed timed(entries[119]);
+	glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+
+void gl_profile_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	Timed timed(entries[120]);
+	glGetAttachedShaders(program, maxCount, count, shaders);
+}
+
+GLint gl_profile_glGetAttribLocation(GLuint program, const GLchar *name) {
+	Timed timed(entries[121]);
+	return glGetAttribLocation(program, name);
+}
+
+void gl_profile_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	Timed timed(entries[122]);
+	glGetProgramiv(program, pname, params);
+}
+
+void gl_profile_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	Timed timed(entries[123]);
+	glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+void gl_profile_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	Timed timed(entries[124]);
+	glGetShaderiv(shader, pname, params);
+}
+
+void gl_profile_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	Timed timed(entries[125]);
+	glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+void gl_profile_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	Timed timed(entries[126]);
+	glGetShaderSource(shader, bufSize, length, source);
+}
+
+GLint gl_profile_glGetUniformLocation(GLuint program, const GLchar *name) {
+	Timed timed(entries[127]);
+	return glGetUniformLocation(program, name);
+}
+
+void gl_profile_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	Timed timed(entries[128]);
+	glGetUniformfv(program, location, params);
+}
+
+void gl_profile_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	Timed timed(entries[129]);
+	glGetUniformiv(program, location, params);
+}
+
+void gl_profile_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	Timed timed(entries[130]);
+	glGetVertexAttribdv(index, pname, params);
+}
+
+void gl_profile_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	Timed timed(entries[131]);
+	glGetVertexAttribfv(index, pname, params);
+}
+
+void gl_profile_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	Timed timed(entries[132]);
+	glGetVertexAttribiv(index, pname, params);
+}
+
+void gl_profile_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	Timed timed(entries[133]);
+	glGetVertexAttribPointerv(index, pname, pointer);
+}
+
+GLboolean gl_profile_glIsProgram(GLuint program) {
+	Timed timed(entries[134]);
+	return glIsProgram(program);
+}
+
+GLboolean gl_profile_glIsShader(GLuint shader) {
+	Timed timed(entries[135]);
+	return glIsShader(shader);
+}
+
+void gl_profile_glLinkProgram(GLuint program) {
+	Timed timed(entries[136]);
+	glLinkProgram(program);
+}
+
+void gl_profile_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	Timed timed(entries[137]);
+	glShaderSource(shader, count, string, length);
+}
+
+void gl_profile_glUseProgram(GLuint program) {
+	Timed timed(entries[138]);
+	glUseProgram(program);
+}
+
+void gl_profile_glUniform1f(GLint location, GLfloat v0) {
+	Timed timed(entries[139]);
+	glUniform1f(location, v0);
+}
+
+void gl_profile_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	Timed timed(entries[140]);
+	glUniform2f(location, v0, v1);
+}
+
+void gl_profile_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	Timed timed(entries[141]);
+	glUniform3f(location, v0, v1, v2);
+}
+
+void gl_profile_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	Timed timed(entries[142]);
+	glUniform4f(location, v0, v1, v2, v3);
+}
+
+void gl_profile_glUniform1i(GLint location, GLint v0) {
+	Timed timed(entries[143]);
+	glUniform1i(location, v0);
+}
+
+void gl_profile_glUniform2i(GLint location, GLint v0, GLint v1) {
+	Timed timed(entries[144]);
+	glUniform2i(location, v0, v1);
+}
+
+void gl_profile_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	Timed timed(entries[145]);
+	glUniform3i(location, v0, v1, v2);
+}
+
+void gl_profile_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	Timed timed(entries[146]);
+	glUniform4i(location, v0, v1, v2, v3);
+}
+
+void gl_profile_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	Timed timed(entries[147]);
+	glUniform1fv(location, count, value);
+}
+
+void gl_profile_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	Timed timed(entries[148]);
+	glUniform2fv(location, count, value);
+}
+
+void gl_profile_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	Timed timed(entries[149]);
+	glUniform3fv(location, count, value);
+}
+
+void gl_profile_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	Timed timed(entries[150]);
+	glUniform4fv(location, count, value);
+}
+
+void gl_profile_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	Timed timed(entries[151]);
+	glUniform1iv(location, count, value);
+}
+
+void gl_profile_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	Timed timed(entries[152]);
+	glUniform2iv(location, count, value);
+}
+
+void gl_profile_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	Timed timed(entries[153]);
+	glUniform3iv(location, count, value);
+}
+
+void gl_profile_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	Timed timed(entries[154]);
+	glUniform4iv(location, count, value);
+}
+
+void gl_profile_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[155]);
+	glUniformMatrix2fv(location, count, transpose, value);
+}
+
+void gl_profile_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[156]);
+	glUniformMatrix3fv(location, count, transpose, value);
+}
+
+void gl_profile_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[157]);
+	glUniformMatrix4fv(location, count, transpose, value);
+}
+
+void gl_profile_glValidateProgram(GLuint program) {
+	Timed timed(entries[158]);
+	glValidateProgram(program);
+}
+
+void gl_profile_glVertexAttrib1d(GLuint index, GLdouble x) {
+	Timed timed(entries[159]);
+	glVertexAttrib1d(index, x);
+}
+
+void gl_profile_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	Timed timed(entries[160]);
+	glVertexAttrib1dv(index, v);
+}
+
+void gl_profile_glVertexAttrib1f(GLuint index, GLfloat x) {
+	Timed timed(entries[161]);
+	glVertexAttrib1f(index, x);
+}
+
+void gl_profile_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	Timed timed(entries[162]);
+	glVertexAttrib1fv(index, v);
+}
+
+void gl_profile_glVertexAttrib1s(GLuint index, GLshort x) {
+	Timed timed(entries[163]);
+	glVertexAttrib1s(index, x);
+}
+
+void gl_profile_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	Timed timed(entries[164]);
+	glVertexAttrib1sv(index, v);
+}
+
+void gl_profile_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	Timed timed(entries[165]);
+	glVertexAttrib2d(index, x, y);
+}
+
+void gl_profile_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	Timed timed(entries[166]);
+	glVertexAttrib2dv(index, v);
+}
+
+void gl_profile_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	Timed timed(entries[167]);
+	glVertexAttrib2f(index, x, y);
+}
+
+void gl_profile_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	Timed timed(entries[168]);
+	glVertexAttrib2fv(index, v);
+}
+
+void gl_profile_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	Timed timed(entries[169]);
+	glVertexAttrib2s(index, x, y);
+}
+
+void gl_profile_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	Timed timed(entries[170]);
+	glVertexAttrib2sv(index, v);
+}
+
+void gl_profile_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	Timed timed(entries[171]);
+	glVertexAttrib3d(index, x, y, z);
+}
+
+void gl_profile_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	Timed timed(entries[172]);
+	glVertexAttrib3dv(index, v);
+}
+
+void gl_profile_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	Timed timed(entries[173]);
+	glVertexAttrib3f(index, x, y, z);
+}
+
+void gl_profile_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	Timed timed(entries[174]);
+	glVertexAttrib3fv(index, v);
+}
+
+void gl_profile_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	Timed timed(entries[175]);
+	glVertexAttrib3s(index, x, y, z);
+}
+
+void gl_profile_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	Timed timed(entries[176]);
+	glVertexAttrib3sv(index, v);
+}
+
+void gl_profile_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	Timed timed(entries[177]);
+	glVertexAttrib4Nbv(index, v);
+}
+
+void gl_profile_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	Timed timed(entries[178]);
+	glVertexAttrib4Niv(index, v);
+}
+
+void gl_profile_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	Timed timed(entries[179]);
+	glVertexAttrib4Nsv(index, v);
+}
+
+void gl_profile_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	Timed timed(entries[180]);
+	glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+void gl_profile_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	Timed timed(entries[181]);
+	glVertexAttrib4Nubv(index, v);
+}
+
+void gl_profile_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	Timed timed(entries[182]);
+	glVertexAttrib4Nuiv(index, v);
+}
+
+void gl_profile_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	Timed timed(entries[183]);
+	glVertexAttrib4Nusv(index, v);
+}
+
+void gl_profile_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	Timed timed(entries[184]);
+	glVertexAttrib4bv(index, v);
+}
+
+void gl_profile_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	Timed timed(entries[185]);
+	glVertexAttrib4d(index, x, y, z, w);
+}
+
+void gl_profile_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	Timed timed(entries[186]);
+	glVertexAttrib4dv(index, v);
+}
+
+void gl_profile_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	Timed timed(entries[187]);
+	glVertexAttrib4f(index, x, y, z, w);
+}
+
+void gl_profile_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	Timed timed(entries[188]);
+	glVertexAttrib4fv(index, v);
+}
+
+void gl_profile_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	Timed timed(entries[189]);
+	glVertexAttrib4iv(index, v);
+}
+
+void gl_profile_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	Timed timed(entries[190]);
+	glVertexAttrib4s(index, x, y, z, w);
+}
+
+void gl_profile_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	Timed timed(entries[191]);
+	glVertexAttrib4sv(index, v);
+}
+
+void gl_profile_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	Timed timed(entries[192]);
+	glVertexAttrib4ubv(index, v);
+}
+
+void gl_profile_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	Timed timed(entries[193]);
+	glVertexAttrib4uiv(index, v);
+}
+
+void gl_profile_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	Timed timed(entries[194]);
+	glVertexAttrib4usv(index, v);
+}
+
+void gl_profile_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	Timed timed(entries[195]);
+	glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+void gl_profile_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[196]);
+	glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+void gl_profile_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[197]);
+	glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+void gl_profile_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[198]);
+	glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+void gl_profile_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[199]);
+	glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+void gl_profile_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[200]);
+	glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+void gl_profile_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Timed timed(entries[201]);
+	glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+void gl_profile_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	Timed timed(entries[202]);
+	glColorMaski(index, r, g, b, a);
+}
+
+void gl_profile_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	Timed timed(entries[203]);
+	glGetBooleani_v(target, index, data);
+}
+
+void gl_profile_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	Timed timed(entries[204]);
+	glGetIntegeri_v(target, index, data);
+}
+
+void gl_profile_glEnablei(GLenum target, GLuint index) {
+	Timed timed(entries[205]);
+	glEnablei(target, index);
+}
+
+void gl_profile_glDisablei(GLenum target, GLuint index) {
+	Timed timed(entries[206]);
+	glDisablei(target, index);
+}
+
+GLboolean gl_profile_glIsEnabledi(GLenum target, GLuint index) {
+	Timed timed(entries[207]);
+	return glIsEnabledi(target, index);
+}
+
+void gl_profile_glBeginTransformFeedback(GLenum primitiveMode) {
+	Timed timed(entries[208]);
+	glBeginTransformFeedback(primitiveMode);
+}
+
+void gl_profile_glEndTransformFeedback(void) {
+	Timed timed(entries[209]);
+	glEndTransformFeedback();
+}
+
+void gl_profile_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	Timed timed(entries[210]);
+	glBindBufferRange(target, index, buffer, offset, size);
+}
+
+void gl_profile_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	Timed timed(entries[211]);
+	glBindBufferBase(target, index, buffer);
+}
+
+void gl_profile_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	Timed timed(entries[212]);
+	glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+void gl_profile_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	Timed timed(entries[213]);
+	glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+
+void gl_profile_glClampColor(GLenum target, GLenum clamp) {
+	Timed timed(entries[214]);
+	glClampColor(target, clamp);
+}
+
+void gl_profile_glBeginConditionalRender(GLuint id, GLenum mode) {
+	Timed timed(entries[215]);
+	glBeginConditionalRender(id, mode);
+}
+
+void gl_profile_glEndConditionalRender(void) {
+	Timed timed(entries[216]);
+	glEndConditionalRender();
+}
+
+void gl_profile_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	Timed timed(entries[217]);
+	glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+void gl_profile_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	Timed timed(entries[218]);
+	glGetVertexAttribIiv(index, pname, params);
+}
+
+void gl_profile_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	Timed timed(entries[219]);
+	glGetVertexAttribIuiv(index, pname, params);
+}
+
+void gl_profile_glVertexAttribI1i(GLuint index, GLint x) {
+	Timed timed(entries[220]);
+	glVertexAttribI1i(index, x);
+}
+
+void gl_profile_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	Timed timed(entries[221]);
+	glVertexAttribI2i(index, x, y);
+}
+
+void gl_profile_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	Timed timed(entries[222]);
+	glVertexAttribI3i(index, x, y, z);
+}
+
+void gl_profile_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	Timed timed(entries[223]);
+	glVertexAttribI4i(index, x, y, z, w);
+}
+
+void gl_profile_glVertexAttribI1ui(GLuint index, GLuint x) {
+	Timed timed(entries[224]);
+	glVertexAttribI1ui(index, x);
+}
+
+void gl_profile_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	Timed timed(entries[225]);
+	glVertexAttribI2ui(index, x, y);
+}
+
+void gl_profile_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	Timed timed(entries[226]);
+	glVertexAttribI3ui(index, x, y, z);
+}
+
+void gl_profile_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	Timed timed(entries[227]);
+	glVertexAttribI4ui(index, x, y, z, w);
+}
+
+void gl_profile_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	Timed timed(entries[228]);
+	glVertexAttribI1iv(index, v);
+}
+
+void gl_profile_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	Timed timed(entries[229]);
+	glVertexAttribI2iv(index, v);
+}
+
+void gl_profile_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	Timed timed(entries[230]);
+	glVertexAttribI3iv(index, v);
+}
+
+void gl_profile_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	Timed timed(entries[231]);
+	glVertexAttribI4iv(index, v);
+}
+
+void gl_profile_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	Timed timed(entries[232]);
+	glVertexAttribI1uiv(index, v);
+}
+
+void gl_profile_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	Timed timed(entries[233]);
+	glVertexAttribI2uiv(index, v);
+}
+
+void gl_profile_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	Timed timed(entries[234]);
+	glVertexAttribI3uiv(index, v);
+}
+
+void gl_profile_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	Timed timed(entries[235]);
+	glVertexAttribI4uiv(index, v);
+}
+
+void gl_profile_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	Timed timed(entries[236]);
+	glVertexAttribI4bv(index, v);
+}
+
+void gl_profile_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	Timed timed(entries[237]);
+	glVertexAttribI4sv(index, v);
+}
+
+void gl_profile_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	Timed timed(entries[238]);
+	glVertexAttribI4ubv(index, v);
+}
+
+void gl_profile_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	Timed timed(entries[239]);
+	glVertexAttribI4usv(index, v);
+}
+
+void gl_profile_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	Timed timed(entries[240]);
+	glGetUniformuiv(program, location, params);
+}
+
+void gl_profile_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	Timed timed(entries[241]);
+	glBindFragDataLocation(program, color, name);
+}
+
+GLint gl_profile_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	Timed timed(entries[242]);
+	return glGetFragDataLocation(program, name);
+}
+
+void gl_profile_glUniform1ui(GLint location, GLuint v0) {
+	Timed timed(entries[243]);
+	glUniform1ui(location, v0);
+}
+
+void gl_profile_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	Timed timed(entries[244]);
+	glUniform2ui(location, v0, v1);
+}
+
+void gl_profile_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	Timed timed(entries[245]);
+	glUniform3ui(location, v0, v1, v2);
+}
+
+void gl_profile_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	Timed timed(entries[246]);
+	glUniform4ui(location, v0, v1, v2, v3);
+}
+
+void gl_profile_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	Timed timed(entries[247]);
+	glUniform1uiv(location, count, value);
+}
+
+void gl_profile_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	Timed timed(entries[248]);
+	glUniform2uiv(location, count, value);
+}
+
+void gl_profile_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	Timed timed(entries[249]);
+	glUniform3uiv(location, count, value);
+}
+
+void gl_profile_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	Timed timed(entries[250]);
+	glUniform4uiv(location, count, value);
+}
+
+void gl_profile_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	Timed timed(entries[251]);
+	glTexParameterIiv(target, pname, params);
+}
+
+void gl_profile_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	Timed timed(entries[252]);
+	glTexParameterIuiv(target, pname, params);
+}
+
+void gl_profile_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	Timed timed(entries[253]);
+	glGetTexParameterIiv(target, pname, params);
+}
+
+void gl_profile_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	Timed timed(entries[254]);
+	glGetTexParameterIuiv(target, pname, params);
+}
+
+void gl_profile_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	Timed timed(entries[255]);
+	glClearBufferiv(buffer, drawbuffer, value);
+}
+
+void gl_profile_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	Timed timed(entries[256]);
+	glClearBufferuiv(buffer, drawbuffer, value);
+}
+
+void gl_profile_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	Timed timed(entries[257]);
+	glClearBufferfv(buffer, drawbuffer, value);
+}
+
+void gl_profile_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	Timed timed(entries[258]);
+	glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+const GLubyte *gl_profile_glGetStringi(GLenum name, GLuint index) {
+	Timed timed(entries[259]);
+	return glGetStringi(name, index);
+}
+
+GLboolean gl_profile_glIsRenderbuffer(GLuint renderbuffer) {
+	Timed timed(entries[260]);
+	return glIsRenderbuffer(renderbuffer);
+}
+
+void gl_profile_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	Timed timed(entries[261]);
+	glBindRenderbuffer(target, renderbuffer);
+}
+
+void gl_profile_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	Timed timed(entries[262]);
+	glDeleteRenderbuffers(n, renderbuffers);
+}
+
+void gl_profile_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	Timed timed(entries[263]);
+	glGenRenderbuffers(n, renderbuffers);
+}
+
+void gl_profile_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	Timed timed(entries[264]);
+	glRenderbufferStorage(target, internalformat, width, height);
+}
+
+void gl_profile_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	Timed timed(entries[265]);
+	glGetRenderbufferParameteriv(target, pname, params);
+}
+
+GLboolean gl_profile_glIsFramebuffer(GLuint framebuffer) {
+	Timed timed(entries[266]);
+	return glIsFramebuffer(framebuffer);
+}
+
+void gl_profile_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	Timed timed(entries[267]);
+	glBindFramebuffer(target, framebuffer);
+}
+
+void gl_profile_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	Timed timed(entries[268]);
+	glDeleteFramebuffers(n, framebuffers);
+}
+
+void gl_profile_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	Timed timed(entries[269]);
+	glGenFramebuffers(n, framebuffers);
+}
+
+GLenum gl_profile_glCheckFramebufferStatus(GLenum target) {
+	Timed timed(entries[270]);
+	return glCheckFramebufferStatus(target);
+}
+
+void gl_profile_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	Timed timed(entries[271]);
+	glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+void gl_profile_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	Timed timed(entries[272]);
+	glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+void gl_profile_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	Timed timed(entries[273]);
+	glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+void gl_profile_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	Timed timed(entries[274]);
+	glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+void gl_profile_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	Timed timed(entries[275]);
+	glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+void gl_profile_glGenerateMipmap(GLenum target) {
+	Timed timed(entries[276]);
+	glGenerateMipmap(target);
+}
+
+void gl_profile_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	Timed timed(entries[277]);
+	glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+void gl_profile_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	Timed timed(entries[278]);
+	glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+void gl_profile_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	Timed timed(entries[279]);
+	glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+void *gl_profile_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	Timed timed(entries[280]);
+	return glMapBufferRange(target, offset, length, access);
+}
+
+void gl_profile_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	Timed timed(entries[281]);
+	glFlushMappedBufferRange(target, offset, length);
+}
+
+void gl_profile_glBindVertexArray(GLuint array) {
+	Timed timed(entries[282]);
+	glBindVertexArray(array);
+}
+
+void gl_profile_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	Timed timed(entries[283]);
+	glDeleteVertexArrays(n, arrays);
+}
+
+void gl_profile_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	Timed timed(entries[284]);
+	glGenVertexArrays(n, arrays);
+}
+
+GLboolean gl_profile_glIsVertexArray(GLuint array) {
+	Timed timed(entries[285]);
+	return glIsVertexArray(array);
+}
+
+void gl_profile_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	Timed timed(entries[286]);
+	glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+void gl_profile_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	Timed timed(entries[287]);
+	glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+void gl_profile_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	Timed timed(entries[288]);
+	glTexBuffer(target, internalformat, buffer);
+}
+
+void gl_profile_glPrimitiveRestartIndex(GLuint index) {
+	Timed timed(entries[289]);
+	glPrimitiveRestartIndex(index);
+}
+
+void gl_profile_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	Timed timed(entries[290]);
+	glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+void gl_profile_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	Timed timed(entries[291]);
+	glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+
+void gl_profile_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	Timed timed(entries[292]);
+	glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+
+void gl_profile_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	Timed timed(entries[293]);
+	glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+
+GLuint gl_profile_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	Timed timed(entries[294]);
+	return glGetUniformBlockIndex(program, uniformBlockName);
+}
+
+void gl_profile_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	Timed timed(entries[295]);
+	glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+
+void gl_profile_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	Timed timed(entries[296]);
+	glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+void gl_profile_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	Timed timed(entries[297]);
+	glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+void gl_profile_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	Timed timed(entries[298]);
+	glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+void gl_profile_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	Timed timed(entries[299]);
+	glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+void gl_profile_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	Timed timed(entries[300]);
+	glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+
+void gl_profile_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	Timed timed(entries[301]);
+	glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+
+void gl_profile_glProvokingVertex(GLenum mode) {
+	Timed timed(entries[302]);
+	glProvokingVertex(mode);
+}
+
+GLsync gl_profile_glFenceSync(GLenum condition, GLbitfield flags) {
+	Timed timed(entries[303]);
+	return glFenceSync(condition, flags);
+}
+
+GLboolean gl_profile_glIsSync(GLsync sync) {
+	Timed timed(entries[304]);
+	return glIsSync(sync);
+}
+
+void gl_profile_glDeleteSync(GLsync sync) {
+	Timed timed(entries[305]);
+	glDeleteSync(sync);
+}
+
+GLenum gl_profile_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	Timed timed(entries[306]);
+	return glClientWaitSync(sync, flags, timeout);
+}
+
+void gl_profile_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	Timed timed(entries[307]);
+	glWaitSync(sync, flags, timeout);
+}
+
+void gl_profile_glGetInteger64v(GLenum pname, GLint64 *data) {
+	Timed timed(entries[308]);
+	glGetInteger64v(pname, data);
+}
+
+void gl_profile_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+	Timed timed(entries[309]);
+	glGetSynciv(sync, pname, bufSize, length, values);
+}
+
+void gl_profile_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	Timed timed(entries[310]);
+	glGetInteger64i_v(target, index, data);
+}
+
+void gl_profile_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	Timed timed(entries[311]);
+	glGetBufferParameteri64v(target, pname, params);
+}
+
+void gl_profile_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	Timed timed(entries[312]);
+	glFramebufferTexture(target, attachment, texture, level);
+}
+
+void gl_profile_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	Timed timed(entries[313]);
+	glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+void gl_profile_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	Timed timed(entries[314]);
+	glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+void gl_profile_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	Timed timed(entries[315]);
+	glGetMultisamplefv(pname, index, val);
+}
+
+void gl_profile_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	Timed timed(entries[316]);
+	glSampleMaski(maskNumber, mask);
+}
+
+void gl_profile_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	Timed timed(entries[317]);
+	glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+GLint gl_profile_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	Timed timed(entries[318]);
+	return glGetFragDataIndex(program, name);
+}
+
+void gl_profile_glGenSamplers(GLsizei count, GLuint *samplers) {
+	Timed timed(entries[319]);
+	glGenSamplers(count, samplers);
+}
+
+void gl_profile_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	Timed timed(entries[320]);
+	glDeleteSamplers(count, samplers);
+}
+
+GLboolean gl_profile_glIsSampler(GLuint sampler) {
+	Timed timed(entries[321]);
+	return glIsSampler(sampler);
+}
+
+void gl_profile_glBindSampler(GLuint unit, GLuint sampler) {
+	Timed timed(entries[322]);
+	glBindSampler(unit, sampler);
+}
+
+void gl_profile_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	Timed timed(entries[323]);
+	glSamplerParameteri(sampler, pname, param);
+}
+
+void gl_profile_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	Timed timed(entries[324]);
+	glSamplerParameteriv(sampler, pname, param);
+}
+
+void gl_profile_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	Timed timed(entries[325]);
+	glSamplerParameterf(sampler, pname, param);
+}
+
+void gl_profile_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	Timed timed(entries[326]);
+	glSamplerParameterfv(sampler, pname, param);
+}
+
+void gl_profile_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	Timed timed(entries[327]);
+	glSamplerParameterIiv(sampler, pname, param);
+}
+
+void gl_profile_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	Timed timed(entries[328]);
+	glSamplerParameterIuiv(sampler, pname, param);
+}
+
+void gl_profile_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	Timed timed(entries[329]);
+	glGetSamplerParameteriv(sampler, pname, params);
+}
+
+void gl_profile_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	Timed timed(entries[330]);
+	glGetSamplerParameterIiv(sampler, pname, params);
+}
+
+void gl_profile_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	Timed timed(entries[331]);
+	glGetSamplerParameterfv(sampler, pname, params);
+}
+
+void gl_profile_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	Timed timed(entries[332]);
+	glGetSamplerParameterIuiv(sampler, pname, params);
+}
+
+void gl_profile_glQueryCounter(GLuint id, GLenum target) {
+	Timed timed(entries[333]);
+	glQueryCounter(id, target);
+}
+
+void gl_profile_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	Timed timed(entries[334]);
+	glGetQueryObjecti64v(id, pname, params);
+}
+
+void gl_profile_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	Timed timed(entries[335]);
+	glGetQueryObjectui64v(id, pname, params);
+}
+
+void gl_profile_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	Timed timed(entries[336]);
+	glVertexAttribDivisor(index, divisor);
+}
+
+void gl_profile_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Timed timed(entries[337]);
+	glVertexAttribP1ui(index, type, normalized, value);
+}
+
+void gl_profile_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Timed timed(entries[338]);
+	glVertexAttribP1uiv(index, type, normalized, value);
+}
+
+void gl_profile_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Timed timed(entries[339]);
+	glVertexAttribP2ui(index, type, normalized, value);
+}
+
+void gl_profile_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Timed timed(entries[340]);
+	glVertexAttribP2uiv(index, type, normalized, value);
+}
+
+void gl_profile_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Timed timed(entries[341]);
+	glVertexAttribP3ui(index, type, normalized, value);
+}
+
+void gl_profile_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Timed timed(entries[342]);
+	glVertexAttribP3uiv(index, type, normalized, value);
+}
+
+void gl_profile_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Timed timed(entries[343]);
+	glVertexAttribP4ui(index, type, normalized, value);
+}
+
+void gl_profile_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Timed timed(entries[344]);
+	glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+#endif
@@ -1277,3 +1277,718 @@ GLAPI void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean
 GLAPI void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 
 }
+
+//Optional call instrumentation: when GL_PROFILE is defined, every gl* function above
+// is redirected to a wrapper that counts calls, CPU time, and bytes uploaded per entry point.
+//(Uploads sourced from a bound GL_PIXEL_UNPACK_BUFFER -- a null 'pixels' offset -- aren't counted.)
+#ifdef GL_PROFILE
+
+#include <stddef.h>
+
+struct GLProfileEntry {
+	char const *name;
+	uint64_t calls;
+	uint64_t bytes; //data uploaded by glBufferData, glBufferSubData, glTex[Sub]Image2D/3D
+	uint64_t nanoseconds; //CPU time spent in the call
+};
+
+//per-entry-point totals since the last gl_profile_reset() (GL thread only):
+GLProfileEntry *gl_profile_entries(size_t *count);
+void gl_profile_reset();
+
+void gl_profile_glCullFace(GLenum mode);
+void gl_profile_glFrontFace(GLenum mode);
+void gl_profile_glHint(GLenum target, GLenum mode);
+void gl_profile_glLineWidth(GLfloat width);
+void gl_profile_glPointSize(GLfloat size);
+void gl_profile_glPolygonMode(GLenum face, GLenum mode);
+void gl_profile_glScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_profile_glTexParameterf(GLenum target, GLenum pname, GLfloat param);
+void gl_profile_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params);
+void gl_profile_glTexParameteri(GLenum target, GLenum pname, GLint param);
+void gl_profile_glTexParameteriv(GLenum target, GLenum pname, const GLint *params);
+void gl_profile_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
+void gl_profile_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+void gl_profile_glDrawBuffer(GLenum buf);
+void gl_profile_glClear(GLbitfield mask);
+void gl_profile_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void gl_profile_glClearStencil(GLint s);
+void gl_profile_glClearDepth(GLdouble depth);
+void gl_profile_glStencilMask(GLuint mask);
+void gl_profile_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+void gl_profile_glDepthMask(GLboolean flag);
+void gl_profile_glDisable(GLenum cap);
+void gl_profile_glEnable(GLenum cap);
+void gl_profile_glFinish(void);
+void gl_profile_glFlush(void);
+void gl_profile_glBlendFunc(GLenum sfactor, GLenum dfactor);
+void gl_profile_glLogicOp(GLenum opcode);
+void gl_profile_glStencilFunc(GLenum func, GLint ref, GLuint mask);
+void gl_profile_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass);
+void gl_profile_glDepthFunc(GLenum func);
+void gl_profile_glPixelStoref(GLenum pname, GLfloat param);
+void gl_profile_glPixelStorei(GLenum pname, GLint param);
+void gl_profile_glReadBuffer(GLenum src);
+void gl_profile_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+void gl_profile_glGetBooleanv(GLenum pname, GLboolean *data);
+void gl_profile_glGetDoublev(GLenum pname, GLdouble *data);
+GLenum gl_profile_glGetError(void);
+void gl_profile_glGetFloatv(GLenum pname, GLfloat *data);
+void gl_profile_glGetIntegerv(GLenum pname, GLint *data);
+const GLubyte *gl_profile_glGetString(GLenum name);
+void gl_profile_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
+void gl_profile_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params);
+void gl_profile_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params);
+void gl_profile_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params);
+void gl_profile_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params);
+GLboolean gl_profile_glIsEnabled(GLenum cap);
+void gl_profile_glDepthRange(GLdouble n, GLdouble f);
+void gl_profile_glViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_profile_glDrawArrays(GLenum mode, GLint first, GLsizei count);
+void gl_profile_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
+void gl_profile_glGetPointerv(GLenum pname, void **params);
+void gl_profile_glPolygonOffset(GLfloat factor, GLfloat units);
+void gl_profile_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
+void gl_profile_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
+void gl_profile_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
+void gl_profile_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_profile_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
+void gl_profile_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+void gl_profile_glBindTexture(GLenum target, GLuint texture);
+void gl_profile_glDeleteTextures(GLsizei n, const GLuint *textures);
+void gl_profile_glGenTextures(GLsizei n, GLuint *textures);
+GLboolean gl_profile_glIsTexture(GLuint texture);
+void gl_profile_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
+void gl_profile_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
+void gl_profile_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
+void gl_profile_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_profile_glActiveTexture(GLenum texture);
+void gl_profile_glSampleCoverage(GLfloat value, GLboolean invert);
+void gl_profile_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data);
+void gl_profile_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
+void gl_profile_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data);
+void gl_profile_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
+void gl_profile_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
+void gl_profile_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
+void gl_profile_glGetCompressedTexImage(GLenum target, GLint level, void *img);
+void gl_profile_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+void gl_profile_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount);
+void gl_profile_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
+void gl_profile_glPointParameterf(GLenum pname, GLfloat param);
+void gl_profile_glPointParameterfv(GLenum pname, const GLfloat *params);
+void gl_profile_glPointParameteri(GLenum pname, GLint param);
+void gl_profile_glPointParameteriv(GLenum pname, const GLint *params);
+void gl_profile_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void gl_profile_glBlendEquation(GLenum mode);
+void gl_profile_glGenQueries(GLsizei n, GLuint *ids);
+void gl_profile_glDeleteQueries(GLsizei n, const GLuint *ids);
+GLboolean gl_profile_glIsQuery(GLuint id);
+void gl_profile_glBeginQuery(GLenum target, GLuint id);
+void gl_profile_glEndQuery(GLenum target);
+void gl_profile_glGetQueryiv(GLenum target, GLenum pname, GLint *params);
+void gl_profile_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params);
+void gl_profile_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params);
+void gl_profile_glBindBuffer(GLenum target, GLuint buffer);
+void gl_profile_glDeleteBuffers(GLsizei n, const GLuint *buffers);
+void gl_profile_glGenBuffers(GLsizei n, GLuint *buffers);
+GLboolean gl_profile_glIsBuffer(GLuint buffer);
+void gl_profile_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+void gl_profile_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+void gl_profile_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data);
+void *gl_profile_glMapBuffer(GLenum target, GLenum access);
+GLboolean gl_profile_glUnmapBuffer(GLenum target);
+void gl_profile_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params);
+void gl_profile_glGetBufferPointerv(GLenum target, GLenum pname, void **params);
+void gl_profile_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha);
+void gl_profile_glDrawBuffers(GLsizei n, const GLenum *bufs);
+void gl_profile_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
+void gl_profile_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask);
+void gl_profile_glStencilMaskSeparate(GLenum face, GLuint mask);
+void gl_profile_glAttachShader(GLuint program, GLuint shader);
+void gl_profile_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name);
+void gl_profile_glCompileShader(GLuint shader);
+GLuint gl_profile_glCreateProgram(void);
+GLuint gl_profile_glCreateShader(GLenum type);
+void gl_profile_glDeleteProgram(GLuint program);
+void gl_profile_glDeleteShader(GLuint shader);
+void gl_profile_glDetachShader(GLuint program, GLuint shader);
+void gl_profile_glDisableVertexAttribArray(GLuint index);
+void gl_profile_glEnableVertexAttribArray(GLuint index);
+void gl_profile_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+void gl_profile_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+void gl_profile_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);
+GLint gl_profile_glGetAttribLocation(GLuint program, const GLchar *name);
+void gl_profile_glGetProgramiv(GLuint program, GLenum pname, GLint *params);
+void gl_profile_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void gl_profile_glGetShaderiv(GLuint shader, GLenum pname, GLint *params);
+void gl_profile_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void gl_profile_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source);
+GLint gl_profile_glGetUniformLocation(GLuint program, const GLchar *name);
+void gl_profile_glGetUniformfv(GLuint program, GLint location, GLfloat *params);
+void gl_profile_glGetUniformiv(GLuint program, GLint location, GLint *params);
+void gl_profile_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params);
+void gl_profile_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params);
+void gl_profile_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params);
+void gl_profile_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer);
+GLboolean gl_profile_glIsProgram(GLuint program);
+GLboolean gl_profile_glIsShader(GLuint shader);
+void gl_profile_glLinkProgram(GLuint program);
+void gl_profile_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
+void gl_profile_glUseProgram(GLuint program);
+void gl_profile_glUniform1f(GLint location, GLfloat v0);
+void gl_profile_glUniform2f(GLint location, GLfloat v0, GLfloat v1);
+void gl_profile_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+void gl_profile_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+void gl_profile_glUniform1i(GLint location, GLint v0);
+void gl_profile_glUniform2i(GLint location, GLint v0, GLint v1);
+void gl_profile_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2);
+void gl_profile_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
+void gl_profile_glUniform1fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_profile_glUniform2fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_profile_glUniform3fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_profile_glUniform4fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_profile_glUniform1iv(GLint location, GLsizei count, const GLint *value);
+void gl_profile_glUniform2iv(GLint location, GLsizei count, const GLint *value);
+void gl_profile_glUniform3iv(GLint location, GLsizei count, const GLint *value);
+void gl_profile_glUniform4iv(GLint location, GLsizei count, const GLint *value);
+void gl_profile_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glValidateProgram(GLuint program);
+void gl_profile_glVertexAttrib1d(GLuint index, GLdouble x);
+void gl_profile_glVertexAttrib1dv(GLuint index, const GLdouble *v);
+void gl_profile_glVertexAttrib1f(GLuint index, GLfloat x);
+void gl_profile_glVertexAttrib1fv(GLuint index, const GLfloat *v);
+void gl_profile_glVertexAttrib1s(GLuint index, GLshort x);
+void gl_profile_glVertexAttrib1sv(GLuint index, const GLshort *v);
+void gl_profile_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y);
+void gl_profile_glVertexAttrib2dv(GLuint index, const GLdouble *v);
+void gl_profile_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y);
+void gl_profile_glVertexAttrib2fv(GLuint index, const GLfloat *v);
+void gl_profile_glVertexAttrib2s(GLuint index, GLshort x, GLshort y);
+void gl_profile_glVertexAttrib2sv(GLuint index, const GLshort *v);
+void gl_profile_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z);
+void gl_profile_glVertexAttrib3dv(GLuint index, const GLdouble *v);
+void gl_profile_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z);
+void gl_profile_glVertexAttrib3fv(GLuint index, const GLfloat *v);
+void gl_profile_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z);
+void gl_profile_glVertexAttrib3sv(GLuint index, const GLshort *v);
+void gl_profile_glVertexAttrib4Nbv(GLuint index, const GLbyte *v);
+void gl_profile_glVertexAttrib4Niv(GLuint index, const GLint *v);
+void gl_profile_glVertexAttrib4Nsv(GLuint index, const GLshort *v);
+void gl_profile_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
+void gl_profile_glVertexAttrib4Nubv(GLuint index, const GLubyte *v);
+void gl_profile_glVertexAttrib4Nuiv(GLuint index, const GLuint *v);
+void gl_profile_glVertexAttrib4Nusv(GLuint index, const GLushort *v);
+void gl_profile_glVertexAttrib4bv(GLuint index, const GLbyte *v);
+void gl_profile_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+void gl_profile_glVertexAttrib4dv(GLuint index, const GLdouble *v);
+void gl_profile_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+void gl_profile_glVertexAttrib4fv(GLuint index, const GLfloat *v);
+void gl_profile_glVertexAttrib4iv(GLuint index, const GLint *v);
+void gl_profile_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
+void gl_profile_glVertexAttrib4sv(GLuint index, const GLshort *v);
+void gl_profile_glVertexAttrib4ubv(GLuint index, const GLubyte *v);
+void gl_profile_glVertexAttrib4uiv(GLuint index, const GLuint *v);
+void gl_profile_glVertexAttrib4usv(GLuint index, const GLushort *v);
+void gl_profile_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
+void gl_profile_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_profile_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
+void gl_profile_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data);
+void gl_profile_glGetIntegeri_v(GLenum target, GLuint index, GLint *data);
+void gl_profile_glEnablei(GLenum target, GLuint index);
+void gl_profile_glDisablei(GLenum target, GLuint index);
+GLboolean gl_profile_glIsEnabledi(GLenum target, GLuint index);
+void gl_profile_glBeginTransformFeedback(GLenum primitiveMode);
+void gl_profile_glEndTransformFeedback(void);
+void gl_profile_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+void gl_profile_glBindBufferBase(GLenum target, GLuint index, GLuint buffer);
+void gl_profile_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode);
+void gl_profile_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name);
+void gl_profile_glClampColor(GLenum target, GLenum clamp);
+void gl_profile_glBeginConditionalRender(GLuint id, GLenum mode);
+void gl_profile_glEndConditionalRender(void);
+void gl_profile_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
+void gl_profile_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params);
+void gl_profile_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params);
+void gl_profile_glVertexAttribI1i(GLuint index, GLint x);
+void gl_profile_glVertexAttribI2i(GLuint index, GLint x, GLint y);
+void gl_profile_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z);
+void gl_profile_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w);
+void gl_profile_glVertexAttribI1ui(GLuint index, GLuint x);
+void gl_profile_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y);
+void gl_profile_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z);
+void gl_profile_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
+void gl_profile_glVertexAttribI1iv(GLuint index, const GLint *v);
+void gl_profile_glVertexAttribI2iv(GLuint index, const GLint *v);
+void gl_profile_glVertexAttribI3iv(GLuint index, const GLint *v);
+void gl_profile_glVertexAttribI4iv(GLuint index, const GLint *v);
+void gl_profile_glVertexAttribI1uiv(GLuint index, const GLuint *v);
+void gl_profile_glVertexAttribI2uiv(GLuint index, const GLuint *v);
+void gl_profile_glVertexAttribI3uiv(GLuint index, const GLuint *v);
+void gl_profile_glVertexAttribI4uiv(GLuint index, const GLuint *v);
+void gl_profile_glVertexAttribI4bv(GLuint index, const GLbyte *v);
+void gl_profile_glVertexAttribI4sv(GLuint index, const GLshort *v);
+void gl_profile_glVertexAttribI4ubv(GLuint index, const GLubyte *v);
+void gl_profile_glVertexAttribI4usv(GLuint index, const GLushort *v);
+void gl_profile_glGetUniformuiv(GLuint program, GLint location, GLuint *params);
+void gl_profile_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name);
+GLint gl_profile_glGetFragDataLocation(GLuint program, const GLchar *name);
+void gl_profile_glUniform1ui(GLint location, GLuint v0);
+void gl_profile_glUniform2ui(GLint location, GLuint v0, GLuint v1);
+void gl_profile_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2);
+void gl_profile_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);
+void gl_profile_glUniform1uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_profile_glUniform2uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_profile_glUniform3uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_profile_glUniform4uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_profile_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params);
+void gl_profile_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params);
+void gl_profile_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params);
+void gl_profile_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params);
+void gl_profile_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value);
+void gl_profile_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value);
+void gl_profile_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value);
+void gl_profile_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
+const GLubyte *gl_profile_glGetStringi(GLenum name, GLuint index);
+GLboolean gl_profile_glIsRenderbuffer(GLuint renderbuffer);
+void gl_profile_glBindRenderbuffer(GLenum target, GLuint renderbuffer);
+void gl_profile_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers);
+void gl_profile_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers);
+void gl_profile_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+void gl_profile_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params);
+GLboolean gl_profile_glIsFramebuffer(GLuint framebuffer);
+void gl_profile_glBindFramebuffer(GLenum target, GLuint framebuffer);
+void gl_profile_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers);
+void gl_profile_glGenFramebuffers(GLsizei n, GLuint *framebuffers);
+GLenum gl_profile_glCheckFramebufferStatus(GLenum target);
+void gl_profile_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void gl_profile_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void gl_profile_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset);
+void gl_profile_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+void gl_profile_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params);
+void gl_profile_glGenerateMipmap(GLenum target);
+void gl_profile_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+void gl_profile_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
+void gl_profile_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
+void *gl_profile_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+void gl_profile_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length);
+void gl_profile_glBindVertexArray(GLuint array);
+void gl_profile_glDeleteVertexArrays(GLsizei n, const GLuint *arrays);
+void gl_profile_glGenVertexArrays(GLsizei n, GLuint *arrays);
+GLboolean gl_profile_glIsVertexArray(GLuint array);
+void gl_profile_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+void gl_profile_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
+void gl_profile_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer);
+void gl_profile_glPrimitiveRestartIndex(GLuint index);
+void gl_profile_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+void gl_profile_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices);
+void gl_profile_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);
+void gl_profile_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName);
+GLuint gl_profile_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName);
+void gl_profile_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);
+void gl_profile_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);
+void gl_profile_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+void gl_profile_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+void gl_profile_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+void gl_profile_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex);
+void gl_profile_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex);
+void gl_profile_glProvokingVertex(GLenum mode);
+GLsync gl_profile_glFenceSync(GLenum condition, GLbitfield flags);
+GLboolean gl_profile_glIsSync(GLsync sync);
+void gl_profile_glDeleteSync(GLsync sync);
+GLenum gl_profile_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+void gl_profile_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+void gl_profile_glGetInteger64v(GLenum pname, GLint64 *data);
+void gl_profile_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);
+void gl_profile_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data);
+void gl_profile_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params);
+void gl_profile_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level);
+void gl_profile_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
+void gl_profile_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
+void gl_profile_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val);
+void gl_profile_glSampleMaski(GLuint maskNumber, GLbitfield mask);
+void gl_profile_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name);
+GLint gl_profile_glGetFragDataIndex(GLuint program, const GLchar *name);
+void gl_profile_glGenSamplers(GLsizei count, GLuint *samplers);
+void gl_profile_glDeleteSamplers(GLsizei count, const GLuint *samplers);
+GLboolean gl_profile_glIsSampler(GLuint sampler);
+void gl_profile_glBindSampler(GLuint unit, GLuint sampler);
+void gl_profile_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param);
+void gl_profile_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param);
+void gl_profile_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param);
+void gl_profile_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param);
+void gl_profile_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param);
+void gl_profile_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param);
+void gl_profile_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params);
+void gl_profile_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params);
+void gl_profile_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params);
+void gl_profile_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params);
+void gl_profile_glQueryCounter(GLuint id, GLenum target);
+void gl_profile_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params);
+void gl_profile_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params);
+void gl_profile_glVertexAttribDivisor(GLuint index, GLuint divisor);
+void gl_profile_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_profile_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void gl_profile_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_profile_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void gl_profile_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_profile_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void gl_profile_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_profile_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+
+//(GL.cpp defines GL_PROFILE_NO_REDIRECT so that it can call the real functions)
+#ifndef GL_PROFILE_NO_REDIRECT
+#define glCullFace gl_profile_glCullFace
+#define glFrontFace gl_profile_glFrontFace
+#define glHint gl_profile_glHint
+#define glLineWidth gl_profile_glLineWidth
+#define glPointSize gl_profile_glPointSize
+#define glPolygonMode gl_profile_glPolygonMode
+#define glScissor gl_profile_glScissor
+#define glTexParameterf gl_profile_glTexParameterf
+#define glTexParameterfv gl_profile_glTexParameterfv
+#define glTexParameteri gl_profile_glTexParameteri
+#define glTexParameteriv gl_profile_glTexParameteriv
+#define glTexImage1D gl_profile_glTexImage1D
+#define glTexImage2D gl_profile_glTexImage2D
+#define glDrawBuffer gl_profile_glDrawBuffer
+#define glClear gl_profile_glClear
+#define glClearColor gl_profile_glClearColor
+#define glClearStencil gl_profile_glClearStencil
+#define glClearDepth gl_profile_glClearDepth
+#define glStencilMask gl_profile_glStencilMask
+#define glColorMask gl_profile_glColorMask
+#define glDepthMask gl_profile_glDepthMask
+#define glDisable gl_profile_glDisable
+#define glEnable gl_profile_glEnable
+#define glFinish gl_profile_glFinish
+#define glFlush gl_profile_glFlush
+#define glBlendFunc gl_profile_glBlendFunc
+#define glLogicOp gl_profile_glLogicOp
+#define glStencilFunc gl_profile_glStencilFunc
+#define glStencilOp gl_profile_glStencilOp
+#define glDepthFunc gl_profile_glDepthFunc
+#define glPixelStoref gl_profile_glPixelStoref
+#define glPixelStorei gl_profile_glPixelStorei
+#define glReadBuffer gl_profile_glReadBuffer
+#define glReadPixels gl_profile_glReadPixels
+#define glGetBooleanv gl_profile_glGetBooleanv
+#define glGetDoublev gl_profile_glGetDoublev
+#define glGetError gl_profile_glGetError
+#define glGetFloatv gl_profile_glGetFloatv
+#define glGetIntegerv gl_profile_glGetIntegerv
+#define glGetString gl_profile_glGetString
+#define glGetTexImage gl_profile_glGetTexImage
+#define glGetTexParameterfv gl_profile_glGetTexParameterfv
+#define glGetTexParameteriv gl_profile_glGetTexParameteriv
+#define glGetTexLevelParameterfv gl_profile_glGetTexLevelParameterfv
+#define glGetTexLevelParameteriv gl_profile_glGetTexLevelParameteriv
+#define glIsEnabled gl_profile_glIsEnabled
+#define glDepthRange gl_profile_glDepthRange
+#define glViewport gl_profile_glViewport
+#define glDrawArrays gl_profile_glDrawArrays
+#define glDrawElements gl_profile_glDrawElements
+#define glGetPointerv gl_profile_glGetPointerv
+#define glPolygonOffset gl_profile_glPolygonOffset
+#define glCopyTexImage1D gl_profile_glCopyTexImage1D
+#define glCopyTexImage2D gl_profile_glCopyTexImage2D
+#define glCopyTexSubImage1D gl_profile_glCopyTexSubImage1D
+#define glCopyTexSubImage2D gl_profile_glCopyTexSubImage2D
+#define glTexSubImage1D gl_profile_glTexSubImage1D
+#define glTexSubImage2D gl_profile_glTexSubImage2D
+#define glBindTexture gl_profile_glBindTexture
+#define glDeleteTextures gl_profile_glDeleteTextures
+#define glGenTextures gl_profile_glGenTextures
+#define glIsTexture gl_profile_glIsTexture
+#define glDrawRangeElements gl_profile_glDrawRangeElements
+#define glTexImage3D gl_profile_glTexImage3D
+#define glTexSubImage3D gl_profile_glTexSubImage3D
+#define glCopyTexSubImage3D gl_profile_glCopyTexSubImage3D
+#define glActiveTexture gl_profile_glActiveTexture
+#define glSampleCoverage gl_profile_glSampleCoverage
+#define glCompressedTexImage3D gl_profile_glCompressedTexImage3D
+#define glCompressedTexImage2D gl_profile_glCompressedTexImage2D
+#define glCompressedTexImage1D gl_profile_glCompressedTexImage1D
+#define glCompressedTexSubImage3D gl_profile_glCompressedTexSubImage3D
+#define glCompressedTexSubImage2D gl_profile_glCompressedTexSubImage2D
+#define glCompressedTexSubImage1D gl_profile_glCompressedTexSubImage1D
+#define glGetCompressedTexImage gl_profile_glGetCompressedTexImage
+#define glBlendFuncSeparate gl_profile_glBlendFuncSeparate
+#define glMultiDrawArrays gl_profile_glMultiDrawArrays
+#define glMultiDrawElements gl_profile_glMultiDrawElements
+#define glPointParameterf gl_profile_glPointParameterf
+#define glPointParameterfv gl_profile_glPointParameterfv
+#define glPointParameteri gl_profile_glPointParameteri
+#define glPointParameteriv gl_profile_glPointParameteriv
+#define glBlendColor gl_profile_glBlendColor
+#define glBlendEquation gl_profile_glBlendEquation
+#define glGenQueries gl_profile_glGenQueries
+#define glDeleteQueries gl_profile_glDeleteQueries
+#define glIsQuery gl_profile_glIsQuery
+#define glBeginQuery gl_profile_glBeginQuery
+#define glEndQuery gl_profile_glEndQuery
+#define glGetQueryiv gl_profile_glGetQueryiv
+#define glGetQueryObjectiv gl_profile_glGetQueryObjectiv
+#define glGetQueryObjectuiv gl_profile_glGetQueryObjectuiv
+#define glBindBuffer gl_profile_glBindBuffer
+#define glDeleteBuffers gl_profile_glDeleteBuffers
+#define glGenBuffers gl_profile_glGenBuffers
+#define glIsBuffer gl_profile_glIsBuffer
+#define glBufferData gl_profile_glBufferData
+#define glBufferSubData gl_profile_glBufferSubData
+#define glGetBufferSubData gl_profile_glGetBufferSubData
+#define glMapBuffer gl_profile_glMapBuffer
+#define glUnmapBuffer gl_profile_glUnmapBuffer
+#define glGetBufferParameteriv gl_profile_glGetBufferParameteriv
+#define glGetBufferPointerv gl_profile_glGetBufferPointerv
+#define glBlendEquationSeparate gl_profile_glBlendEquationSeparate
+#define glDrawBuffers gl_profile_glDrawBuffers
+#define glStencilOpSeparate gl_profile_glStencilOpSeparate
+#define glStencilFuncSeparate gl_profile_glStencilFuncSeparate
+#define glStencilMaskSeparate gl_profile_glStencilMaskSeparate
+#define glAttachShader gl_profile_glAttachShader
+#define glBindAttribLocation gl_profile_glBindAttribLocation
+#define glCompileShader gl_profile_glCompileShader
+#define glCreateProgram gl_profile_glCreateProgram
+#define glCreateShader gl_profile_glCreateShader
+#define glDeleteProgram gl_profile_glDeleteProgram
+#define glDeleteShader gl_profile_glDeleteShader
+#define glDetachShader gl_profile_glDetachShader
+#define glDisableVertexAttribArray gl_profile_glDisableVertexAttribArray
+#define glEnableVertexAttribArray gl_profile_glEnableVertexAttribArray
+#define glGetActiveAttrib gl_profile_glGetActiveAttrib
+#define glGetActiveUniform gl_profile_glGetActiveUniform
+#define glGetAttachedShaders gl_profile_glGetAttachedShaders
+#define glGetAttribLocation gl_profile_glGetAttribLocation
+#define glGetProgramiv gl_profile_glGetProgramiv
+#define glGetProgramInfoLog gl_profile_glGetProgramInfoLog
+#define glGetShaderiv gl_profile_glGetShaderiv
+#define glGetShaderInfoLog gl_profile_glGetShaderInfoLog
+#define glGetShaderSource gl_profile_glGetShaderSource
+#define glGetUniformLocation gl_profile_glGetUniformLocation
+#define glGetUniformfv gl_profile_glGetUniformfv
+#define glGetUniformiv gl_profile_glGetUniformiv
+#define glGetVertexAttribdv gl_profile_glGetVertexAttribdv
+#define glGetVertexAttribfv gl_profile_glGetVertexAttribfv
+#define glGetVertexAttribiv gl_profile_glGetVertexAttribiv
+#define glGetVertexAttribPointerv gl_profile_glGetVertexAttribPointerv
+#define glIsProgram gl_profile_glIsProgram
+#define glIsShader gl_profile_glIsShader
+#define glLinkProgram gl_profile_glLinkProgram
+#define glShaderSource gl_profile_glShaderSource
+#define glUseProgram gl_profile_glUseProgram
+#define glUniform1f gl_profile_glUniform1f
+#define glUniform2f gl_profile_glUniform2f
+#define glUniform3f gl_profile_glUniform3f
+#define glUniform4f gl_profile_glUniform4f
+#define glUniform1i gl_profile_glUniform1i
+#define glUniform2i gl_profile_glUniform2i
+#define glUniform3i gl_profile_glUniform3i
+#define glUniform4i gl_profile_glUniform4i
+#define glUniform1fv gl_profile_glUniform1fv
+#define glUniform2fv gl_profile_glUniform2fv
+#define glUniform3fv gl_profile_glUniform3fv
+#define glUniform4fv gl_profile_glUniform4fv
+#define glUniform1iv gl_profile_glUniform1iv
+#define glUniform2iv gl_profile_glUniform2iv
+#define glUniform3iv gl_profile_glUniform3iv
+#define glUniform4iv gl_profile_glUniform4iv
+#define glUniformMatrix2fv gl_profile_glUniformMatrix2fv
+#define glUniformMatrix3fv gl_profile_glUniformMatrix3fv
+#define glUniformMatrix4fv gl_profile_glUniformMatrix4fv
+#define glValidateProgram gl_profile_glValidateProgram
+#define glVertexAttrib1d gl_profile_glVertexAttrib1d
+#define glVertexAttrib1dv gl_profile_glVertexAttrib1dv
+#define glVertexAttrib1f gl_profile_glVertexAttrib1f
+#define glVertexAttrib1fv gl_profile_glVertexAttrib1fv
+#define glVertexAttrib1s gl_profile_glVertexAttrib1s
+#define glVertexAttrib1sv gl_profile_glVertexAttrib1sv
+#define glVertexAttrib2d gl_profile_glVertexAttrib2d
+#define glVertexAttrib2dv gl_profile_glVertexAttrib2dv
+#define glVertexAttrib2f gl_profile_glVertexAttrib2f
+#define glVertexAttrib2fv gl_profile_glVertexAttrib2fv
+#define glVertexAttrib2s gl_profile_glVertexAttrib2s
+#define glVertexAttrib2sv gl_profile_glVertexAttrib2sv
+#define glVertexAttrib3d gl_profile_glVertexAttrib3d
+#define glVertexAttrib3dv gl_profile_glVertexAttrib3dv
+#define glVertexAttrib3f gl_profile_glVertexAttrib3f
+#define glVertexAttrib3fv gl_profile_glVertexAttrib3fv
+#define glVertexAttrib3s gl_profile_glVertexAttrib3s
+#define glVertexAttrib3sv gl_profile_glVertexAttrib3sv
+#define glVertexAttrib4Nbv gl_profile_glVertexAttrib4Nbv
+#define glVertexAttrib4Niv gl_profile_glVertexAttrib4Niv
+#define glVertexAttrib4Nsv gl_profile_glVertexAttrib4Nsv
+#define glVertexAttrib4Nub gl_profile_glVertexAttrib4Nub
+#define glVertexAttrib4Nubv gl_profile_glVertexAttrib4Nubv
+#define glVertexAttrib4Nuiv gl_profile_glVertexAttrib4Nuiv
+#define glVertexAttrib4Nusv gl_profile_glVertexAttrib4Nusv
+#define glVertexAttrib4bv gl_profile_glVertexAttrib4bv
+#define glVertexAttrib4d gl_profile_glVertexAttrib4d
+#define glVertexAttrib4dv gl_profile_glVertexAttrib4dv
+#define glVertexAttrib4f gl_profile_glVertexAttrib4f
+#define glVertexAttrib4fv gl_profile_glVertexAttrib4fv
+#define glVertexAttrib4iv gl_profile_glVertexAttrib4iv
+#define glVertexAttrib4s gl_profile_glVertexAttrib4s
+#define glVertexAttrib4sv gl_profile_glVertexAttrib4sv
+#define glVertexAttrib4ubv gl_profile_glVertexAttrib4ubv
+#define glVertexAttrib4uiv gl_profile_glVertexAttrib4uiv
+#define glVertexAttrib4usv gl_profile_glVertexAttrib4usv
+#define glVertexAttribPointer gl_profile_glVertexAttribPointer
+#define glUniformMatrix2x3fv gl_profile_glUniformMatrix2x3fv
+#define glUniformMatrix3x2fv gl_profile_glUniformMatrix3x2fv
+#define glUniformMatrix2x4fv gl_profile_glUniformMatrix2x4fv
+#define glUniformMatrix4x2fv gl_profile_glUniformMatrix4x2fv
+#define glUniformMatrix3x4fv gl_profile_glUniformMatrix3x4fv
+#define glUniformMatrix4x3fv gl_profile_glUniformMatrix4x3fv
+#define glColorMaski gl_profile_glColorMaski
+#define glGetBooleani_v gl_profile_glGetBooleani_v
+#define glGetIntegeri_v gl_profile_glGetIntegeri_v
+#define glEnablei gl_profile_glEnablei
+#define glDisablei gl_profile_glDisablei
+#define glIsEnabledi gl_profile_glIsEnabledi
+#define glBeginTransformFeedback gl_profile_glBeginTransformFeedback
+#define glEndTransformFeedback gl_profile_glEndTransformFeedback
+#define glBindBufferRange gl_profile_glBindBufferRange
+#define glBindBufferBase gl_profile_glBindBufferBase
+#define glTransformFeedbackVaryings gl_profile_glTransformFeedbackVaryings
+#define glGetTransformFeedbackVarying gl_profile_glGetTransformFeedbackVarying
+#define glClampColor gl_profile_glClampColor
+#define glBeginConditionalRender gl_profile_glBeginConditionalRender
+#define glEndConditionalRender gl_profile_glEndConditionalRender
+#define glVertexAttribIPointer gl_profile_glVertexAttribIPointer
+#define glGetVertexAttribIiv gl_profile_glGetVertexAttribIiv
+#define glGetVertexAttribIuiv gl_profile_glGetVertexAttribIuiv
+#define glVertexAttribI1i gl_profile_glVertexAttribI1i
+#define glVertexAttribI2i gl_profile_glVertexAttribI2i
+#define glVertexAttribI3i gl_profile_glVertexAttribI3i
+#define glVertexAttribI4i gl_profile_glVertexAttribI4i
+#define glVertexAttribI1ui gl_profile_glVertexAttribI1ui
+#define glVertexAttribI2ui gl_profile_glVertexAttribI2ui
+#define glVertexAttribI3ui gl_profile_glVertexAttribI3ui
+#define glVertexAttribI4ui gl_profile_glVertexAttribI4ui
+#define glVertexAttribI1iv gl_profile_glVertexAttribI1iv
+#define glVertexAttribI2iv gl_profile_glVertexAttribI2iv
+#define glVertexAttribI3iv gl_profile_glVertexAttribI3iv
+#define glVertexAttribI4iv gl_profile_glVertexAttribI4iv
+#define glVertexAttribI1uiv gl_profile_glVertexAttribI1uiv
+#define glVertexAttribI2uiv gl_profile_glVertexAttribI2uiv
+#define glVertexAttribI3uiv gl_profile_glVertexAttribI3uiv
+#define glVertexAttribI4uiv gl_profile_glVertexAttribI4uiv
+#define glVertexAttribI4bv gl_profile_glVertexAttribI4bv
+#define glVertexAttribI4sv gl_profile_glVertexAttribI4sv
+#define glVertexAttribI4ubv gl_profile_glVertexAttribI4ubv
+#define glVertexAttribI4usv gl_profile_glVertexAttribI4usv
+#define glGetUniformuiv gl_profile_glGetUniformuiv
+#define glBindFragDataLocation gl_profile_glBindFragDataLocation
+#define glGetFragDataLocation gl_profile_glGetFragDataLocation
+#define glUniform1ui gl_profile_glUniform1ui
+#define glUniform2ui gl_profile_glUniform2ui
+#define glUniform3ui gl_profile_glUniform3ui
+#define glUniform4ui gl_profile_glUniform4ui
+#define glUniform1uiv gl_profile_glUniform1uiv
+#define glUniform2uiv gl_profile_glUniform2uiv
+#define glUniform3uiv gl_profile_glUniform3uiv
+#define glUniform4uiv gl_profile_glUniform4uiv
+#define glTexParameterIiv gl_profile_glTexParameterIiv
+#define glTexParameterIuiv gl_profile_glTexParameterIuiv
+#define glGetTexParameterIiv gl_profile_glGetTexParameterIiv
+#define glGetTexParameterIuiv gl_profile_glGetTexParameterIuiv
+#define glClearBufferiv gl_profile_glClearBufferiv
+#define glClearBufferuiv gl_profile_glClearBufferuiv
+#define glClearBufferfv gl_profile_glClearBufferfv
+#define glClearBufferfi gl_profile_glClearBufferfi
+#define glGetStringi gl_profile_glGetStringi
+#define glIsRenderbuffer gl_profile_glIsRenderbuffer
+#define glBindRenderbuffer gl_profile_glBindRenderbuffer
+#define glDeleteRenderbuffers gl_profile_glDeleteRenderbuffers
+#define glGenRenderbuffers gl_profile_glGenRenderbuffers
+#define glRenderbufferStorage gl_profile_glRenderbufferStorage
+#define glGetRenderbufferParameteriv gl_profile_glGetRenderbufferParameteriv
+#define glIsFramebuffer gl_profile_glIsFramebuffer
+#define glBindFramebuffer gl_profile_glBindFramebuffer
+#define glDeleteFramebuffers gl_profile_glDeleteFramebuffers
+#define glGenFramebuffers gl_profile_glGenFramebuffers
+#define glCheckFramebufferStatus gl_profile_glCheckFramebufferStatus
+#define glFramebufferTexture1D gl_profile_glFramebufferTexture1D
+#define glFramebufferTexture2D gl_profile_glFramebufferTexture2D
+#define glFramebufferTexture3D gl_profile_glFramebufferTexture3D
+#define glFramebufferRenderbuffer gl_profile_glFramebufferRenderbuffer
+#define glGetFramebufferAttachmentParameteriv gl_profile_glGetFramebufferAttachmentParameteriv
+#define glGenerateMipmap gl_profile_glGenerateMipmap
+#define glBlitFramebuffer gl_profile_glBlitFramebuffer
+#define glRenderbufferStorageMultisample gl_profile_glRenderbufferStorageMultisample
+#define glFramebufferTextureLayer gl_profile_glFramebufferTextureLayer
+#define glMapBufferRange gl_profile_glMapBufferRange
+#define glFlushMappedBufferRange gl_profile_glFlushMappedBufferRange
+#define glBindVertexArray gl_profile_glBindVertexArray
+#define glDeleteVertexArrays gl_profile_glDeleteVertexArrays
+#define glGenVertexArrays gl_profile_glGenVertexArrays
+#define glIsVertexArray gl_profile_glIsVertexArray
+#define glDrawArraysInstanced gl_profile_glDrawArraysInstanced
+#define glDrawElementsInstanced gl_profile_glDrawElementsInstanced
+#define glTexBuffer gl_profile_glTexBuffer
+#define glPrimitiveRestartIndex gl_profile_glPrimitiveRestartIndex
+#define glCopyBufferSubData gl_profile_glCopyBufferSubData
+#define glGetUniformIndices gl_profile_glGetUniformIndices
+#define glGetActiveUniformsiv gl_profile_glGetActiveUniformsiv
+#define glGetActiveUniformName gl_profile_glGetActiveUniformName
+#define glGetUniformBlockIndex gl_profile_glGetUniformBlockIndex
+#define glGetActiveUniformBlockiv gl_profile_glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockName gl_profile_glGetActiveUniformBlockName
+#define glUniformBlockBinding gl_profile_glUniformBlockBinding
+#define glDrawElementsBaseVertex gl_profile_glDrawElementsBaseVertex
+#define glDrawRangeElementsBaseVertex gl_profile_glDrawRangeElementsBaseVertex
+#define glDrawElementsInstancedBaseVertex gl_profile_glDrawElementsInstancedBaseVertex
+#define glMultiDrawElementsBaseVertex gl_profile_glMultiDrawElementsBaseVertex
+#define glProvokingVertex gl_profile_glProvokingVertex
+#define glFenceSync gl_profile_glFenceSync
+#define glIsSync gl_profile_glIsSync
+#define glDeleteSync gl_profile_glDeleteSync
+#define glClientWaitSync gl_profile_glClientWaitSync
+#define glWaitSync gl_profile_glWaitSync
+#define glGetInteger64v gl_profile_glGetInteger64v
+#define glGetSynciv gl_profile_glGetSynciv
+#define glGetInteger64i_v gl_profile_glGetInteger64i_v
+#define glGetBufferParameteri64v gl_profile_glGetBufferParameteri64v
+#define glFramebufferTexture gl_profile_glFramebufferTexture
+#define glTexImage2DMultisample gl_profile_glTexImage2DMultisample
+#define glTexImage3DMultisample gl_profile_glTexImage3DMultisample
+#define glGetMultisamplefv gl_profile_glGetMultisamplefv
+#define glSampleMaski gl_profile_glSampleMaski
+#define glBindFragDataLocationIndexed gl_profile_glBindFragDataLocationIndexed
+#define glGetFragDataIndex gl_profile_glGetFragDataIndex
+#define glGenSamplers gl_profile_glGenSamplers
+#define glDeleteSamplers gl_profile_glDeleteSamplers
+#define glIsSampler gl_profile_glIsSampler
+#define glBindSampler gl_profile_glBindSampler
+#define glSamplerParameteri gl_profile_glSamplerParameteri
+#define glSamplerParameteriv gl_profile_glSamplerParameteriv
+#define glSamplerParameterf gl_profile_glSamplerParameterf
+#define glSamplerParameterfv gl_profile_glSamplerParameterfv
+#define glSamplerParameterIiv gl_profile_glSamplerParameterIiv
+#define glSamplerParameterIuiv gl_profile_glSamplerParameterIuiv
+#define glGetSamplerParameteriv gl_profile_glGetSamplerParameteriv
+#define glGetSamplerParameterIiv gl_profile_glGetSamplerParameterIiv
+#define glGetSamplerParameterfv gl_profile_glGetSamplerParameterfv
+#define glGetSamplerParameterIuiv gl_profile_glGetSamplerParameterIuiv
+#define glQueryCounter gl_profile_glQueryCounter
+#define glGetQueryObjecti64v gl_profile_glGetQueryObjecti64v
+#define glGetQueryObjectui64v gl_profile_glGetQueryObjectui64v
+#define glVertexAttribDivisor gl_profile_glVertexAttribDivisor
+#define glVertexAttribP1ui gl_profile_glVertexAttribP1ui
+#define glVertexAttribP1uiv gl_profile_glVertexAttribP1uiv
+#define glVertexAttribP2ui gl_profile_glVertexAttribP2ui
+#define glVertexAttribP2uiv gl_profile_glVertexAttribP2uiv
+#define glVertexAttribP3ui gl_profile_glVertexAttribP3ui
+#define glVertexAttribP3uiv gl_profile_glVertexAttribP3uiv
+#define glVertexAttribP4ui gl_profile_glVertexAttribP4ui
+#define glVertexAttribP4uiv gl_profile_glVertexAttribP4uiv
+#endif
+
+#endif
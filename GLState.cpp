@@ -0,0 +1,177 @@
+#include "GLState.hpp"
+
+#include "Profiler.hpp"
+
+#include <array>
+
+namespace {
+	//shadowed value for "don't know what's bound" (never a valid name):
+	constexpr GLuint Unknown = ~GLuint(0);
+
+	//texture targets with shadowed per-unit bindings:
+	constexpr GLenum TextureTargets[] = {
+		GL_TEXTURE_2D,
+		GL_TEXTURE_BUFFER,
+		GL_TEXTURE_CUBE_MAP,
+		GL_TEXTURE_3D,
+		GL_TEXTURE_2D_ARRAY,
+	};
+	constexpr uint32_t TextureTargetCount = sizeof(TextureTargets) / sizeof(TextureTargets[0]);
+
+	struct State {
+		GLuint program = Unknown;
+		GLuint vao = Unknown;
+		GLuint array_buffer = Unknown;
+		GLenum active_unit = Unknown; //GL_TEXTURE0 + i
+		std::array< std::array< GLuint, TextureTargetCount >, GLState::MaxTextureUnits > textures;
+		int8_t blend = -1; //-1 = unknown
+		int8_t depth_test = -1;
+		GLState::Counts counts;
+
+		State() {
+			for (auto &unit : textures) unit.fill(Unknown);
+		}
+	};
+
+	State &get_state() {
+		static State state;
+		return state;
+	}
+
+	int32_t target_index(GLenum target) {
+		for (uint32_t i = 0; i < TextureTargetCount; ++i) {
+			if (TextureTargets[i] == target) return int32_t(i);
+		}
+		return -1;
+	}
+
+	//returns true (and counts the call as issued) if 'shadow' needs to change to 'value':
+	bool change(GLuint *shadow, GLuint value) {
+		State &state = get_state();
+		if (*shadow == value) {
+			state.counts.skipped += 1;
+			return false;
+		}
+		*shadow = value;
+		state.counts.issued += 1;
+		return true;
+	}
+
+	int8_t *enable_shadow(GLenum cap) {
+		State &state = get_state();
+		if (cap == GL_BLEND) return &state.blend;
+		if (cap == GL_DEPTH_TEST) return &state.depth_test;
+		return nullptr;
+	}
+
+	void set_enabled(GLenum cap, bool enabled) {
+		State &state = get_state();
+		int8_t *shadow = enable_shadow(cap);
+		if (shadow && *shadow == int8_t(enabled)) {
+			state.counts.skipped += 1;
+			return;
+		}
+		if (shadow) *shadow = int8_t(enabled);
+		state.counts.issued += 1;
+		if (enabled) glEnable(cap);
+		else glDisable(cap);
+	}
+}
+
+void GLState::use_program(GLuint program) {
+	if (change(&get_state().program, program)) glUseProgram(program);
+}
+
+void GLState::bind_vertex_array(GLuint vao) {
+	if (change(&get_state().vao, vao)) glBindVertexArray(vao);
+}
+
+void GLState::bind_buffer(GLenum target, GLuint buffer) {
+	State &state = get_state();
+	if (target == GL_ARRAY_BUFFER) {
+		if (change(&state.array_buffer, buffer)) glBindBuffer(target, buffer);
+	} else {
+		state.counts.issued += 1;
+		glBindBuffer(target, buffer);
+	}
+}
+
+void GLState::active_texture(GLenum unit) {
+	if (change(&get_state().active_unit, unit)) glActiveTexture(unit);
+}
+
+void GLState::bind_texture(GLenum target, GLuint texture) {
+	State &state = get_state();
+	uint32_t unit = state.active_unit - GL_TEXTURE0; //(wraps to a large value if Unknown)
+	int32_t index = target_index(target);
+	if (unit < MaxTextureUnits && index >= 0) {
+		if (change(&state.textures[unit][index], texture)) glBindTexture(target, texture);
+	} else {
+		state.counts.issued += 1;
+		glBindTexture(target, texture);
+	}
+}
+
+void GLState::enable(GLenum cap) {
+	set_enabled(cap, true);
+}
+
+void GLState::disable(GLenum cap) {
+	set_enabled(cap, false);
+}
+
+void GLState::delete_program(GLuint program) {
+	State &state = get_state();
+	//(a program in use stays current after deletion, but its name may be reused):
+	if (program != 0 && state.program == program) state.program = Unknown;
+	glDeleteProgram(program);
+}
+
+void GLState::delete_vertex_arrays(GLsizei count, GLuint const *vaos) {
+	State &state = get_state();
+	for (GLsizei i = 0; i < count; ++i) {
+		//deleting the bound vertex array reverts the binding to zero:
+		if (vaos[i] != 0 && state.vao == vaos[i]) state.vao = 0;
+	}
+	glDeleteVertexArrays(count, vaos);
+}
+
+void GLState::delete_buffers(GLsizei count, GLuint const *buffers) {
+	State &state = get_state();
+	for (GLsizei i = 0; i < count; ++i) {
+		if (buffers[i] != 0 && state.array_buffer == buffers[i]) state.array_buffer = 0;
+	}
+	glDeleteBuffers(count, buffers);
+}
+
+void GLState::delete_textures(GLsizei count, GLuint const *textures) {
+	State &state = get_state();
+	for (GLsizei i = 0; i < count; ++i) {
+		if (textures[i] == 0) continue;
+		//deleting a bound texture reverts that binding (on every unit) to zero:
+		for (auto &unit : state.textures) {
+			for (auto &bound : unit) {
+				if (bound == textures[i]) bound = 0;
+			}
+		}
+	}
+	glDeleteTextures(count, textures);
+}
+
+void GLState::invalidate() {
+	State &state = get_state();
+	Counts counts = state.counts;
+	state = State();
+	state.counts = counts;
+}
+
+GLState::Counts const &GLState::counts() {
+	return get_state().counts;
+}
+
+void GLState::end_frame() {
+	State &state = get_state();
+	PROFILE_COUNT("GL state calls issued", double(state.counts.issued));
+	PROFILE_COUNT("GL state calls skipped", double(state.counts.skipped));
+	state.counts = Counts();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <cstdint>
+
+//Shadow copy of the GL binding state, so redundant binds never reach the driver.
+//
+//Tracked: current program, vertex array, GL_ARRAY_BUFFER binding, active texture
+// unit, per-unit texture bindings (first MaxTextureUnits units), and the GL_BLEND /
+// GL_DEPTH_TEST enables. Calls that match the shadowed value are skipped; anything
+// untracked (other buffer targets, other caps, units past the limit) is passed through.
+//
+//All rendering code should change this state through these functions (not glBind* /
+// glUseProgram / glEnable directly), since the cache can't see direct calls. Code that
+// has to go around it should call invalidate() afterward.
+//
+//Deleting a bound object changes bindings behind the cache's back, so delete through
+// the delete_* wrappers here (they update the shadow state, then call glDelete*).
+//
+//GL thread only.
+
+namespace GLState {
+
+//texture units [0,MaxTextureUnits) are shadowed; higher units are passed through:
+constexpr uint32_t MaxTextureUnits = 16;
+
+void use_program(GLuint program);
+void bind_vertex_array(GLuint vao);
+void bind_buffer(GLenum target, GLuint buffer); //only GL_ARRAY_BUFFER is shadowed
+
+//'unit' is GL_TEXTURE0 + i, as for glActiveTexture:
+void active_texture(GLenum unit);
+//bind to the active unit:
+void bind_texture(GLenum target, GLuint texture);
+
+//GL_BLEND and GL_DEPTH_TEST are shadowed; other caps are passed through:
+void enable(GLenum cap);
+void disable(GLenum cap);
+
+//update shadow state, then glDelete*:
+void delete_program(GLuint program);
+void delete_vertex_arrays(GLsizei count, GLuint const *vaos);
+void delete_buffers(GLsizei count, GLuint const *buffers);
+void delete_textures(GLsizei count, GLuint const *textures);
+
+//forget everything (the next call of each kind is always issued):
+void invalidate();
+
+//GL state calls issued / skipped since the last end_frame():
+struct Counts {
+	uint64_t issued = 0;
+	uint64_t skipped = 0;
+};
+Counts const &counts();
+
+//report this frame's counts to the profiler ("GL state calls issued" / "... skipped") and reset them:
+void end_frame();
+
+}
@@ -0,0 +1,192 @@
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//---------------- internal state ----------------
+
+namespace {
+	struct Batch {
+		std::function< void(size_t, size_t) > const *body = nullptr;
+		std::atomic< size_t > remaining{0}; //chunks not yet finished
+		std::mutex error_mutex;
+		std::exception_ptr error;
+	};
+
+	struct Task {
+		Batch *batch;
+		size_t begin, end;
+	};
+
+	struct Queue {
+		std::mutex mutex;
+		std::deque< Task > tasks;
+	};
+
+	struct Scheduler {
+		//queues[0] is shared by threads that aren't workers (e.g., the main thread); queues[1+i] belongs to worker i:
+		std::vector< std::unique_ptr< Queue > > queues;
+		std::vector< std::thread > workers;
+
+		std::atomic< size_t > queued{0}; //tasks sitting in any queue
+		std::mutex sleep_mutex;
+		std::condition_variable sleep_cv;
+		bool stopping = false;
+	};
+
+	Scheduler &get_scheduler() {
+		static Scheduler scheduler;
+		return scheduler;
+	}
+
+	//index of this thread's own queue:
+	thread_local uint32_t own_queue = 0;
+
+	//take a task -- newest from own queue first (cache-warm), otherwise oldest from someone else's:
+	bool take(Task *task) {
+		Scheduler &scheduler = get_scheduler();
+		if (scheduler.queued.load(std::memory_order_acquire) == 0) return false;
+
+		uint32_t count = uint32_t(scheduler.queues.size());
+		{
+			Queue &queue = *scheduler.queues[own_queue];
+			std::unique_lock< std::mutex > lock(queue.mutex);
+			if (!queue.tasks.empty()) {
+				*task = queue.tasks.back();
+				queue.tasks.pop_back();
+				scheduler.queued.fetch_sub(1, std::memory_order_acq_rel);
+				return true;
+			}
+		}
+		for (uint32_t offset = 1; offset < count; ++offset) {
+			Queue &queue = *scheduler.queues[(own_queue + offset) % count];
+			std::unique_lock< std::mutex > lock(queue.mutex);
+			if (!queue.tasks.empty()) {
+				*task = queue.tasks.front();
+				queue.tasks.pop_front();
+				scheduler.queued.fetch_sub(1, std::memory_order_acq_rel);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void run(Task const &task) {
+		Batch &batch = *task.batch;
+		try {
+			(*batch.body)(task.begin, task.end);
+		} catch (...) {
+			std::unique_lock< std::mutex > lock(batch.error_mutex);
+			if (!batch.error) batch.error = std::current_exception();
+		}
+		batch.remaining.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	void worker_main(uint32_t index) {
+		own_queue = index;
+		Scheduler &scheduler = get_scheduler();
+		while (true) {
+			Task task;
+			if (take(&task)) {
+				run(task);
+				continue;
+			}
+			std::unique_lock< std::mutex > lock(scheduler.sleep_mutex);
+			scheduler.sleep_cv.wait(lock, [&](){ return scheduler.stopping || scheduler.queued.load(std::memory_order_acquire) > 0; });
+			if (scheduler.stopping) return;
+		}
+	}
+}
+
+//---------------- JobSystem ----------------
+
+void JobSystem::init(int32_t threads) {
+	Scheduler &scheduler = get_scheduler();
+	assert(scheduler.workers.empty() && "JobSystem::init called twice without shutdown");
+
+	if (threads < 0) {
+		threads = std::max(1, int32_t(std::thread::hardware_concurrency())) - 1;
+	}
+
+	scheduler.stopping = false;
+	scheduler.queues.clear();
+	for (int32_t i = 0; i < threads + 1; ++i) {
+		scheduler.queues.emplace_back(std::make_unique< Queue >());
+	}
+	for (int32_t i = 0; i < threads; ++i) {
+		scheduler.workers.emplace_back(worker_main, uint32_t(i + 1));
+	}
+}
+
+void JobSystem::shutdown() {
+	Scheduler &scheduler = get_scheduler();
+	{
+		std::unique_lock< std::mutex > lock(scheduler.sleep_mutex);
+		scheduler.stopping = true;
+	}
+	scheduler.sleep_cv.notify_all();
+	for (auto &worker : scheduler.workers) {
+		worker.join();
+	}
+	scheduler.workers.clear();
+	scheduler.queues.clear();
+	scheduler.queued = 0;
+}
+
+uint32_t JobSystem::thread_count() {
+	return uint32_t(get_scheduler().workers.size()) + 1;
+}
+
+void JobSystem::parallel_for(size_t count, size_t grain, std::function< void(size_t begin, size_t end) > const &body) {
+	if (count == 0) return;
+	if (grain == 0) grain = 1;
+
+	Scheduler &scheduler = get_scheduler();
+	size_t chunks = (count + grain - 1) / grain;
+	if (scheduler.workers.empty() || chunks == 1) {
+		//nothing to run in parallel with; same chunks, in order:
+		for (size_t begin = 0; begin < count; begin += grain) {
+			body(begin, std::min(count, begin + grain));
+		}
+		return;
+	}
+
+	Batch batch;
+	batch.body = &body;
+	batch.remaining = chunks;
+
+	//count the tasks before they're visible, so 'queued' never goes negative:
+	{
+		std::unique_lock< std::mutex > lock(scheduler.sleep_mutex);
+		scheduler.queued.fetch_add(chunks, std::memory_order_acq_rel);
+	}
+
+	//deal chunks out round-robin, starting with this thread's own queue:
+	uint32_t queue_count = uint32_t(scheduler.queues.size());
+	for (uint32_t q = 0; q < queue_count; ++q) {
+		Queue &queue = *scheduler.queues[(own_queue + q) % queue_count];
+		std::unique_lock< std::mutex > lock(queue.mutex);
+		for (size_t c = q; c < chunks; c += queue_count) {
+			size_t begin = c * grain;
+			queue.tasks.emplace_back(Task{&batch, begin, std::min(count, begin + grain)});
+		}
+	}
+	scheduler.sleep_cv.notify_all();
+
+	//help out until this batch is done:
+	while (batch.remaining.load(std::memory_order_acquire) > 0) {
+		Task task;
+		if (take(&task)) run(task);
+		else std::this_thread::yield();
+	}
+
+	if (batch.error) std::rethrow_exception(batch.error);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+//Small work-stealing job system for data-parallel loops.
+//
+//Each worker thread has its own queue of tasks; idle workers steal from the
+// others, and the thread that calls parallel_for works on tasks until its loop
+// is finished (so nested parallel_for calls are fine).
+//
+//Results are deterministic as long as the loop body only writes to the indices
+// it is given: parallel_for splits [0,count) into the same chunks no matter how
+// many threads there are.
+//
+//If init() hasn't been called (or was called with zero threads), everything
+// runs on the calling thread.
+
+namespace JobSystem {
+
+//start worker threads (threads = number of workers in addition to the calling thread; -1 = hardware concurrency - 1):
+void init(int32_t threads = -1);
+
+//stop worker threads (waits for nothing -- call when no parallel_for is running):
+void shutdown();
+
+//number of threads that run parallel_for tasks (workers + the calling thread):
+uint32_t thread_count();
+
+//call body(begin, end) on consecutive chunks of [0,count), each at most 'grain' long, in parallel:
+// returns once all chunks are done; if a chunk throws, the first exception is rethrown here
+void parallel_for(size_t count, size_t grain, std::function< void(size_t begin, size_t end) > const &body);
+
+}
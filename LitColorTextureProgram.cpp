@@ -2,6 +2,12 @@
 
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
+#include "GLState.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
 
 Scene::Drawable::Pipeline lit_color_texture_program_pipeline;
 
@@ -11,30 +17,22 @@ Load< LitColorTextureProgram > lit_color_texture_program(LoadTagEarly, []() -> L
 	//----- build the pipeline template -----
 	lit_color_texture_program_pipeline.program = ret->program;
 
-	lit_color_texture_program_pipeline.CLIP_FROM_OBJECT_mat4 = ret->CLIP_FROM_OBJECT_mat4;
-	lit_color_texture_program_pipeline.LIGHT_FROM_OBJECT_mat4x3 = ret->LIGHT_FROM_OBJECT_mat4x3;
-	lit_color_texture_program_pipeline.LIGHT_FROM_NORMAL_mat3 = ret->LIGHT_FROM_NORMAL_mat3;
+	//object transforms come from Scene::draw's per-drawable uniform block:
+	lit_color_texture_program_pipeline.object_block = true;
 
-	/* This will be used later if/when we build a light loop into the Scene:
-	lit_color_texture_program_pipeline.LIGHT_TYPE_int = ret->LIGHT_TYPE_int;
-	lit_color_texture_program_pipeline.LIGHT_LOCATION_vec3 = ret->LIGHT_LOCATION_vec3;
-	lit_color_texture_program_pipeline.LIGHT_DIRECTION_vec3 = ret->LIGHT_DIRECTION_vec3;
-	lit_color_texture_program_pipeline.LIGHT_ENERGY_vec3 = ret->LIGHT_ENERGY_vec3;
-	lit_color_texture_program_pipeline.LIGHT_CUTOFF_float = ret->LIGHT_CUTOFF_float;
-	*/
 
 	//make a 1-pixel white texture to bind by default:
 	GLuint tex;
 	glGenTextures(1, &tex);
 
-	glBindTexture(GL_TEXTURE_2D, tex);
+	GLState::bind_texture(GL_TEXTURE_2D, tex);
 	std::vector< glm::u8vec4 > tex_data(1, glm::u8vec4(0xff));
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, tex_data.data());
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	GLState::bind_texture(GL_TEXTURE_2D, 0);
 
 
 	lit_color_texture_program_pipeline.textures[0].texture = tex;
@@ -48,9 +46,15 @@ LitColorTextureProgram::LitColorTextureProgram() {
 	program = gl_compile_program(
 		//vertex shader:
 		"#version 330\n"
-		"uniform mat4 CLIP_FROM_OBJECT;\n"
-		"uniform mat4x3 LIGHT_FROM_OBJECT;\n"
-		"uniform mat3 LIGHT_FROM_NORMAL;\n"
+		"layout(std140) uniform Camera {\n" //per-frame (see Scene::CameraBinding)
+		"	mat4 CLIP_FROM_WORLD;\n"
+		"	mat4x3 LIGHT_FROM_WORLD;\n"
+		"	mat3 LIGHT_FROM_WORLD_NORMAL;\n"
+		"};\n"
+		"layout(std140) uniform Object {\n" //per-drawable (see Scene::ObjectBinding)
+		"	mat4x3 WORLD_FROM_OBJECT;\n"
+		"	mat3 WORLD_FROM_NORMAL;\n"
+		"};\n"
 		"in vec4 Position;\n"
 		"in vec3 Normal;\n"
 		"in vec4 Color;\n"
@@ -60,9 +64,10 @@ LitColorTextureProgram::LitColorTextureProgram() {
 		"out vec4 color;\n"
 		"out vec2 texCoord;\n"
 		"void main() {\n"
-		"	gl_Position = CLIP_FROM_OBJECT * Position;\n"
-		"	position = LIGHT_FROM_OBJECT * Position;\n"
-		"	normal = LIGHT_FROM_NORMAL * Normal;\n"
+		"	vec4 world = vec4(WORLD_FROM_OBJECT * Position, 1.0);\n"
+		"	gl_Position = CLIP_FROM_WORLD * world;\n"
+		"	position = LIGHT_FROM_WORLD * world;\n"
+		"	normal = LIGHT_FROM_WORLD_NORMAL * (WORLD_FROM_NORMAL * Normal);\n"
 		"	color = Color;\n"
 		"	texCoord = TexCoord;\n"
 		"}\n"
@@ -70,11 +75,15 @@ LitColorTextureProgram::LitColorTextureProgram() {
 		//fragment shader:
 		"#version 330\n"
 		"uniform sampler2D TEX;\n"
-		"uniform int LIGHT_TYPE;\n"
-		"uniform vec3 LIGHT_LOCATION;\n"
-		"uniform vec3 LIGHT_DIRECTION;\n"
-		"uniform vec3 LIGHT_ENERGY;\n"
-		"uniform float LIGHT_CUTOFF;\n"
+		"uniform samplerBuffer LIGHTS;\n" //three texels per light: (position, type) (direction, cutoff) (energy, 1/range^2)
+		"uniform usamplerBuffer CLUSTERS;\n" //(first, count) per cluster
+		"uniform usamplerBuffer LIGHT_INDICES;\n"
+		"layout(std140) uniform Lights {\n" //per-frame (see LightClusters::Block)
+		"	ivec3 CLUSTER_COUNT;\n"
+		"	int GLOBAL_LIGHTS;\n" //lights [0,GLOBAL_LIGHTS) light every fragment
+		"	vec2 TILE_FROM_FRAG;\n"
+		"	vec2 SLICE_FROM_LOG_DEPTH;\n"
+		"};\n"
 		"in vec3 position;\n"
 		"in vec3 normal;\n"
 		"in vec4 color;\n"
@@ -83,27 +92,41 @@ LitColorTextureProgram::LitColorTextureProgram() {
 		"float random(vec2 st) { //from https://thebookofshaders.com/10/\n"
 		"	return fract(sin(dot(st, vec2(12.9898, 78.233)))*43758.5453123);\n"
 		"}\n"
+		"vec3 light(int i, vec3 n) {\n"
+		"	vec4 a = texelFetch(LIGHTS, 3*i+0);\n"
+		"	vec4 b = texelFetch(LIGHTS, 3*i+1);\n"
+		"	vec4 c = texelFetch(LIGHTS, 3*i+2);\n"
+		"	int type = int(a.w);\n"
+		"	if (type == 1) { //hemi light \n"
+		"		return (dot(n,-b.xyz) * 0.5 + 0.5) * c.rgb;\n"
+		"	} else if (type == 3) { //directional light \n"
+		"		return max(0.0, dot(n,-b.xyz)) * c.rgb;\n"
+		"	}\n"
+		"	//point or spot light:\n"
+		"	vec3 l = (a.xyz - position);\n"
+		"	float dis2 = dot(l,l);\n"
+		"	l = normalize(l);\n"
+		"	float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
+		"	float w = clamp(1.0 - (dis2 * c.w) * (dis2 * c.w), 0.0, 1.0);\n" //fade to zero at range
+		"	nl *= w * w;\n"
+		"	if (type == 2) { //spot light \n"
+		"		float s = dot(l,-b.xyz);\n"
+		"		nl *= smoothstep(b.w,mix(b.w,1.0,0.1), s);\n"
+		"	}\n"
+		"	return nl * c.rgb;\n"
+		"}\n"
 		"void main() {\n"
 		"	vec3 n = normalize(normal);\n"
-		"	vec3 e;\n"
-		"	if (LIGHT_TYPE == 0) { //point light \n"
-		"		vec3 l = (LIGHT_LOCATION - position);\n"
-		"		float dis2 = dot(l,l);\n"
-		"		l = normalize(l);\n"
-		"		float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
-		"		e = nl * LIGHT_ENERGY;\n"
-		"	} else if (LIGHT_TYPE == 1) { //hemi light \n"
-		"		e = (dot(n,-LIGHT_DIRECTION) * 0.5 + 0.5) * LIGHT_ENERGY;\n"
-		"	} else if (LIGHT_TYPE == 2) { //spot light \n"
-		"		vec3 l = (LIGHT_LOCATION - position);\n"
-		"		float dis2 = dot(l,l);\n"
-		"		l = normalize(l);\n"
-		"		float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
-		"		float c = dot(l,-LIGHT_DIRECTION);\n"
-		"		nl *= smoothstep(LIGHT_CUTOFF,mix(LIGHT_CUTOFF,1.0,0.1), c);\n"
-		"		e = nl * LIGHT_ENERGY;\n"
-		"	} else { //(LIGHT_TYPE == 3) //directional light \n"
-		"		e = max(0.0, dot(n,-LIGHT_DIRECTION)) * LIGHT_ENERGY;\n"
+		"	vec3 e = vec3(0.0);\n"
+		"	for (int i = 0; i < GLOBAL_LIGHTS; ++i) {\n"
+		"		e += light(i, n);\n"
+		"	}\n"
+		//cluster from screen position and view depth (for a perspective projection, gl_FragCoord.w is 1/depth):
+		"	ivec2 tile = min(ivec2(gl_FragCoord.xy * TILE_FROM_FRAG), CLUSTER_COUNT.xy - 1);\n"
+		"	int slice = clamp(int(floor(-log(gl_FragCoord.w) * SLICE_FROM_LOG_DEPTH.x + SLICE_FROM_LOG_DEPTH.y)), 0, CLUSTER_COUNT.z - 1);\n"
+		"	uvec2 cluster = texelFetch(CLUSTERS, (slice * CLUSTER_COUNT.y + tile.y) * CLUSTER_COUNT.x + tile.x).xy;\n"
+		"	for (uint k = 0u; k < cluster.y; ++k) {\n"
+		"		e += light(int(texelFetch(LIGHT_INDICES, int(cluster.x + k)).x), n);\n"
 		"	}\n"
 		"	vec4 albedo = texture(TEX, texCoord) * color;\n"
 		"	fragColor = vec4(e*albedo.rgb, albedo.a);\n"
@@ -120,7 +143,8 @@ LitColorTextureProgram::LitColorTextureProgram() {
 		"		fragColor = vec4(amt,amt,amt,1.0);\n"
 		"	}\n"
 		*/
-		"}\n"
+		"}\n",
+		"lit_color_texture"
 	);
 	//As you can see above, adjacent strings in C/C++ are concatenated.
 	// this is very useful for writing long shader programs inline.
@@ -131,30 +155,231 @@ LitColorTextureProgram::LitColorTextureProgram() {
 	Color_vec4 = glGetAttribLocation(program, "Color");
 	TexCoord_vec2 = glGetAttribLocation(program, "TexCoord");
 
-	//look up the locations of uniforms:
-	CLIP_FROM_OBJECT_mat4 = glGetUniformLocation(program, "CLIP_FROM_OBJECT");
-	LIGHT_FROM_OBJECT_mat4x3 = glGetUniformLocation(program, "LIGHT_FROM_OBJECT");
-	LIGHT_FROM_NORMAL_mat3 = glGetUniformLocation(program, "LIGHT_FROM_NORMAL");
-
-	LIGHT_TYPE_int = glGetUniformLocation(program, "LIGHT_TYPE");
-	LIGHT_LOCATION_vec3 = glGetUniformLocation(program, "LIGHT_LOCATION");
-	LIGHT_DIRECTION_vec3 = glGetUniformLocation(program, "LIGHT_DIRECTION");
-	LIGHT_ENERGY_vec3 = glGetUniformLocation(program, "LIGHT_ENERGY");
-	LIGHT_CUTOFF_float = glGetUniformLocation(program, "LIGHT_CUTOFF");
-
+	//uniform blocks (Camera, Object, Lights) are filled by Scene::draw and LightClusters:
+	Scene::bind_uniform_blocks(program);
 
+	//look up the locations of uniforms:
 	GLuint TEX_sampler2D = glGetUniformLocation(program, "TEX");
+	GLuint LIGHTS_samplerBuffer = glGetUniformLocation(program, "LIGHTS");
+	GLuint CLUSTERS_usamplerBuffer = glGetUniformLocation(program, "CLUSTERS");
+	GLuint LIGHT_INDICES_usamplerBuffer = glGetUniformLocation(program, "LIGHT_INDICES");
 
 	//set TEX to always refer to texture binding zero:
-	glUseProgram(program); //bind program -- glUniform* calls refer to this program now
+	GLState::use_program(program); //bind program -- glUniform* calls refer to this program now
 
 	glUniform1i(TEX_sampler2D, 0); //set TEX to sample from GL_TEXTURE0
+	//light buffers live after the pipeline's textures:
+	glUniform1i(LIGHTS_samplerBuffer, 4);
+	glUniform1i(CLUSTERS_usamplerBuffer, 5);
+	glUniform1i(LIGHT_INDICES_usamplerBuffer, 6);
 
-	glUseProgram(0); //unbind program -- glUniform* calls refer to ??? now
+	GLState::use_program(0); //unbind program -- glUniform* calls refer to ??? now
 }
 
 LitColorTextureProgram::~LitColorTextureProgram() {
-	glDeleteProgram(program);
+	GLState::delete_program(program);
 	program = 0;
 }
 
+
+//-------------------------
+
+LightClusters::LightClusters() {
+	glGenBuffers(1, &block_buffer);
+	glGenBuffers(3, buffers);
+	glGenTextures(3, textures);
+
+	//texture buffers need storage before they can be attached, so start with one (black) light and every cluster empty:
+	rows.assign(3, glm::vec4(0.0f));
+	clusters.assign(TilesX * TilesY * Slices, glm::uvec2(0));
+	indices.assign(1, 0);
+	upload();
+
+	GLenum formats[3] = { GL_RGBA32F, GL_RG32UI, GL_R16UI };
+	for (uint32_t i = 0; i < 3; ++i) {
+		GLState::bind_texture(GL_TEXTURE_BUFFER, textures[i]);
+		glTexBuffer(GL_TEXTURE_BUFFER, formats[i], buffers[i]);
+	}
+	GLState::bind_texture(GL_TEXTURE_BUFFER, 0);
+
+	GL_ERRORS();
+}
+
+LightClusters::~LightClusters() {
+	GLState::delete_textures(3, textures);
+	GLState::delete_buffers(3, buffers);
+	GLState::delete_buffers(1, &block_buffer);
+	block_buffer = 0;
+	for (uint32_t i = 0; i < 3; ++i) {
+		textures[i] = 0;
+		buffers[i] = 0;
+	}
+}
+
+void LightClusters::clear() {
+	global_rows.clear();
+	local_rows.clear();
+	local_spheres.clear();
+}
+
+void LightClusters::add(Scene::Light const &light) {
+	glm::mat4x3 world_from_light = light.transform->make_world_from_local();
+	glm::vec3 direction = -glm::normalize(world_from_light[2]);
+	add(light.type, world_from_light[3], direction, light.energy, light.spot_fov);
+}
+
+void LightClusters::add(Scene::Light::Type type, glm::vec3 const &position, glm::vec3 const &direction, glm::vec3 const &energy, float spot_fov) {
+	if ((global_rows.size() + local_rows.size()) / 3 + 1 > MaxLights) {
+		throw std::runtime_error("LightClusters::add: more than " + std::to_string(uint32_t(MaxLights)) + " lights.");
+	}
+
+	//(type numbers match the shader)
+	if (type == Scene::Light::Hemisphere || type == Scene::Light::Directional) {
+		float t = (type == Scene::Light::Hemisphere ? 1.0f : 3.0f);
+		global_rows.emplace_back(position, t);
+		global_rows.emplace_back(direction, 0.0f);
+		global_rows.emplace_back(energy, 0.0f);
+	} else {
+		float t = (type == Scene::Light::Spot ? 2.0f : 0.0f);
+		//energy / distance^2 drops below MinEnergy at:
+		float range = std::max(1.0f, std::sqrt(std::max(energy.r, std::max(energy.g, energy.b)) / MinEnergy));
+		local_rows.emplace_back(position, t);
+		local_rows.emplace_back(direction, std::cos(0.5f * spot_fov));
+		local_rows.emplace_back(energy, 1.0f / (range * range));
+		local_spheres.emplace_back(position, range);
+	}
+}
+
+void LightClusters::update(Scene::Camera const &camera, glm::uvec2 const &drawable_size) {
+	bin(camera, drawable_size);
+	upload();
+}
+
+void LightClusters::bin(Scene::Camera const &camera, glm::uvec2 const &drawable_size) {
+	Scene::Camera::Matrices const &matrices = camera.matrices();
+	float near = camera.near;
+
+	//slice s covers depths [near * exp(s / slice_scale), near * exp((s+1) / slice_scale)):
+	float slice_scale = float(Slices) / std::log(FarDistance / near);
+	auto slice_of = [&](float depth) {
+		return uint32_t(std::clamp(int32_t(std::floor(std::log(depth / near) * slice_scale)), 0, int32_t(Slices) - 1));
+	};
+	auto slice_begin = [&](uint32_t s) {
+		return near * std::exp(float(s) / slice_scale);
+	};
+	block.global_lights = int32_t(global_rows.size() / 3);
+	block.tile_from_frag = glm::vec2(float(TilesX) / float(drawable_size.x), float(TilesY) / float(drawable_size.y));
+	block.slice_from_log_depth = glm::vec2(slice_scale, -std::log(near) * slice_scale);
+
+	//the tiles covered by camera-space box [min,max] (depths min.z..max.z, both >= near), as [lo,hi]; false if off-screen:
+	float px = matrices.clip_from_camera[0][0];
+	float py = matrices.clip_from_camera[1][1];
+	auto tile_range = [&](glm::vec3 const &min, glm::vec3 const &max, glm::uvec2 *lo, glm::uvec2 *hi) {
+		//x / depth is extreme at the box's corners:
+		float x0 = px * std::min(min.x / min.z, min.x / max.z);
+		float x1 = px * std::max(max.x / min.z, max.x / max.z);
+		float y0 = py * std::min(min.y / min.z, min.y / max.z);
+		float y1 = py * std::max(max.y / min.z, max.y / max.z);
+		if (x1 < -1.0f || x0 > 1.0f || y1 < -1.0f || y0 > 1.0f) return false;
+		auto tile = [](float ndc, uint32_t tiles) {
+			return uint32_t(std::clamp(int32_t(std::floor((ndc * 0.5f + 0.5f) * float(tiles))), 0, int32_t(tiles) - 1));
+		};
+		*lo = glm::uvec2(tile(x0, TilesX), tile(y0, TilesY));
+		*hi = glm::uvec2(tile(x1, TilesX), tile(y1, TilesY));
+		return true;
+	};
+
+	//each local light's tile range in each slice its sphere overlaps (bounds are per-slice, so they stay tight for big lights):
+	struct Span {
+		uint32_t light;
+		uint32_t slice;
+		glm::uvec2 lo, hi;
+	};
+	std::vector< Span > spans;
+	uint32_t first_local = uint32_t(global_rows.size() / 3);
+	for (uint32_t l = 0; l < uint32_t(local_spheres.size()); ++l) {
+		glm::vec3 center = matrices.camera_from_world * glm::vec4(glm::vec3(local_spheres[l]), 1.0f);
+		float range = local_spheres[l].w;
+		//(camera looks along -z, so depth is -z)
+		glm::vec3 min = glm::vec3(center.x - range, center.y - range, std::max(near, -center.z - range));
+		glm::vec3 max = glm::vec3(center.x + range, center.y + range, -center.z + range);
+		if (max.z < near) continue; //behind the camera
+
+		uint32_t s0 = slice_of(min.z);
+		uint32_t s1 = slice_of(max.z);
+		for (uint32_t s = s0; s <= s1; ++s) {
+			glm::vec3 slice_min = glm::vec3(min.x, min.y, std::max(min.z, slice_begin(s)));
+			glm::vec3 slice_max = glm::vec3(max.x, max.y, (s + 1 < Slices ? std::min(max.z, slice_begin(s + 1)) : max.z));
+			Span span;
+			if (!tile_range(slice_min, slice_max, &span.lo, &span.hi)) continue;
+			span.light = first_local + l;
+			span.slice = s;
+			spans.emplace_back(span);
+		}
+	}
+
+	//count, prefix-sum, then fill (spans are in light order, so each cluster's list is sorted):
+	auto cluster_index = [](uint32_t s, uint32_t y, uint32_t x) {
+		return (s * TilesY + y) * TilesX + x;
+	};
+	std::vector< uint32_t > counts(TilesX * TilesY * Slices, 0);
+	for (auto const &span : spans) {
+		for (uint32_t y = span.lo.y; y <= span.hi.y; ++y) {
+			for (uint32_t x = span.lo.x; x <= span.hi.x; ++x) {
+				counts[cluster_index(span.slice, y, x)] += 1;
+			}
+		}
+	}
+	clusters.resize(counts.size());
+	uint32_t total = 0;
+	for (uint32_t c = 0; c < uint32_t(counts.size()); ++c) {
+		clusters[c] = glm::uvec2(total, 0);
+		total += counts[c];
+	}
+	indices.resize(std::max(1U, total)); //(never empty, so the buffer always has storage)
+	for (auto const &span : spans) {
+		for (uint32_t y = span.lo.y; y <= span.hi.y; ++y) {
+			for (uint32_t x = span.lo.x; x <= span.hi.x; ++x) {
+				glm::uvec2 &cluster = clusters[cluster_index(span.slice, y, x)];
+				indices[cluster.x + cluster.y] = uint16_t(span.light);
+				cluster.y += 1;
+			}
+		}
+	}
+
+	rows.clear();
+	rows.insert(rows.end(), global_rows.begin(), global_rows.end());
+	rows.insert(rows.end(), local_rows.begin(), local_rows.end());
+	if (rows.empty()) rows.assign(3, glm::vec4(0.0f));
+}
+
+void LightClusters::upload() {
+	auto send = [](GLuint buffer, void const *data, size_t size) {
+		GLState::bind_buffer(GL_TEXTURE_BUFFER, buffer);
+		//orphan the old storage so the GPU can keep reading last frame's lights while we write these:
+		glBufferData(GL_TEXTURE_BUFFER, size, nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_TEXTURE_BUFFER, 0, size, data);
+	};
+	send(buffers[0], rows.data(), rows.size() * sizeof(glm::vec4));
+	send(buffers[1], clusters.data(), clusters.size() * sizeof(glm::uvec2));
+	send(buffers[2], indices.data(), indices.size() * sizeof(uint16_t));
+	GLState::bind_buffer(GL_TEXTURE_BUFFER, 0);
+
+	GLState::bind_buffer(GL_UNIFORM_BUFFER, block_buffer);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(block), &block, GL_STREAM_DRAW);
+	GLState::bind_buffer(GL_UNIFORM_BUFFER, 0);
+
+	GL_ERRORS();
+}
+
+void LightClusters::bind() const {
+	glBindBufferBase(GL_UNIFORM_BUFFER, Scene::LightsBinding, block_buffer);
+
+	for (uint32_t i = 0; i < 3; ++i) {
+		GLState::active_texture(GL_TEXTURE4 + i);
+		GLState::bind_texture(GL_TEXTURE_BUFFER, textures[i]);
+	}
+	GLState::active_texture(GL_TEXTURE0);
+
+	GL_ERRORS();
+}
@@ -4,7 +4,12 @@
 #include "Load.hpp"
 #include "Scene.hpp"
 
+#include <glm/glm.hpp>
+
+#include <vector>
+
 //Shader program that draws transformed, lit, textured vertices tinted with vertex colors:
+// lit by any number of lights, via the clusters in a LightClusters (see below).
 struct LitColorTextureProgram {
 	LitColorTextureProgram();
 	~LitColorTextureProgram();
@@ -17,20 +22,16 @@ struct LitColorTextureProgram {
 	GLuint Color_vec4 = -1U;
 	GLuint TexCoord_vec2 = -1U;
 
-	//Uniform (per-invocation variable) locations:
-	GLuint CLIP_FROM_OBJECT_mat4 = -1U;
-	GLuint LIGHT_FROM_OBJECT_mat4x3 = -1U;
-	GLuint LIGHT_FROM_NORMAL_mat3 = -1U;
-
-	//lighting:
-	GLuint LIGHT_TYPE_int = -1U;
-	GLuint LIGHT_LOCATION_vec3 = -1U;
-	GLuint LIGHT_DIRECTION_vec3 = -1U;
-	GLuint LIGHT_ENERGY_vec3 = -1U;
-	GLuint LIGHT_CUTOFF_float = -1U;
-	
+	//Uniform blocks:
+	//Camera, Object - transforms (see Scene::CameraBinding, Scene::ObjectBinding)
+	//Lights - cluster layout (see LightClusters::Block)
+
 	//Textures:
 	//TEXTURE0 - texture that is accessed by TexCoord
+	//TEXTURE4 - LIGHTS (GL_TEXTURE_BUFFER)
+	//TEXTURE5 - CLUSTERS (GL_TEXTURE_BUFFER)
+	//TEXTURE6 - LIGHT_INDICES (GL_TEXTURE_BUFFER)
+	// (after Scene::Drawable::Pipeline::TextureCount, so Scene::draw leaves them alone)
 };
 
 extern Load< LitColorTextureProgram > lit_color_texture_program;
@@ -38,3 +39,58 @@ extern Load< LitColorTextureProgram > lit_color_texture_program;
 //For convenient scene-graph setup, copy this object:
 // NOTE: by default, has texture bound to 1-pixel white texture -- so it's okay to use with vertex-color-only meshes.
 extern Scene::Drawable::Pipeline lit_color_texture_program_pipeline;
+
+//A frame's lights, binned into view-space clusters for lit_color_texture_program:
+// the view is cut into TilesX x TilesY screen tiles and Slices depth slices (spaced logarithmically),
+// each point/spot light is listed in every cluster its range touches, and each fragment only
+// shades with the lights listed in its cluster -- plus the "global" (hemisphere/directional) lights,
+// which touch everything and so aren't binned.
+//Point and spot lights fall off as before (1/distance^2) but are windowed to zero at
+// the distance where they'd drop below MinEnergy, so each has a finite range.
+struct LightClusters {
+	LightClusters();
+	~LightClusters();
+
+	enum : uint32_t { TilesX = 16, TilesY = 9, Slices = 24 };
+	enum : uint32_t { MaxLights = 0xffff }; //light indices are stored as 16 bits
+	static constexpr float FarDistance = 200.0f; //slices cover [near, FarDistance]; the last one also holds everything beyond
+	static constexpr float MinEnergy = 1.0f / 256.0f;
+
+	//start a new frame's worth of lights:
+	void clear();
+	//add a light (position and direction from the light's transform; direction is its -z axis):
+	// throws if there would be more than MaxLights
+	void add(Scene::Light const &light);
+	void add(Scene::Light::Type type, glm::vec3 const &position, glm::vec3 const &direction, glm::vec3 const &energy, float spot_fov = 0.0f);
+
+	//bin the lights added since clear() for the view from 'camera' and send everything to the GPU:
+	void update(Scene::Camera const &camera, glm::uvec2 const &drawable_size);
+	//(update is bin then upload; they can be called separately -- e.g., bin on the main thread, upload on the render thread):
+	void bin(Scene::Camera const &camera, glm::uvec2 const &drawable_size);
+	void upload();
+	//bind the Lights uniform block and the buffers (to TEXTURE4-6):
+	// (they stay bound, so call before Scene::draw)
+	void bind() const;
+
+	//lights as three RGBA32F texels each: (position, type) (direction, spot cutoff) (energy, 1/range^2)
+	std::vector< glm::vec4 > global_rows, local_rows;
+	std::vector< glm::vec4 > local_spheres; //(world position, range) per local light
+
+	//results of bin():
+	std::vector< glm::vec4 > rows; //global_rows then local_rows
+	std::vector< glm::uvec2 > clusters; //(first, count) into indices, per cluster
+	std::vector< uint16_t > indices; //light indices (into rows / 3), sorted within each cluster
+
+	//std140 layout of the Lights uniform block:
+	struct Block {
+		glm::ivec3 cluster_count = glm::ivec3(TilesX, TilesY, Slices);
+		int32_t global_lights = 0;
+		glm::vec2 tile_from_frag = glm::vec2(0.0f);
+		glm::vec2 slice_from_log_depth = glm::vec2(0.0f);
+	} block;
+	static_assert(sizeof(Block) == 32, "Block matches the std140 layout of Lights.");
+
+	GLuint block_buffer = 0; //(Scene::LightsBinding)
+	GLuint buffers[3] = {0, 0, 0}; //rows, clusters, indices
+	GLuint textures[3] = {0, 0, 0}; //GL_TEXTURE_BUFFER views of the above
+};
@@ -121,6 +121,13 @@ if (maek.OS === "windows") {
 		`-L${NEST_LIBS}/freetype/lib`, `-lfreetype`
 	);
 }
+
+//profiling build: run as 'GL_PROFILE=1 node Maekfile.js' to count calls, CPU time, and bytes uploaded
+// per GL entry point (see make-GL.py); the counts show up in the profiler overlay.
+if (process.env.GL_PROFILE) {
+	maek.options.CPPFlags.push(maek.OS === 'windows' ? `/DGL_PROFILE` : `-DGL_PROFILE`);
+}
+
 //use COPY to copy a file
 // 'COPY(from, to)'
 // from: file to copy from
@@ -154,13 +161,19 @@ const game_names = [
 	maek.CPP('Character.cpp'),
 	maek.CPP('Player.cpp'),
 	maek.CPP('Rat.cpp'),
+	maek.CPP('CollisionGrid.cpp'),
+	maek.CPP('JobSystem.cpp'),
+	maek.CPP('RenderThread.cpp'),
 	maek.CPP('main.cpp'),
 	maek.CPP('LitColorTextureProgram.cpp'),
 	maek.CPP('ColorTextureProgram.cpp'),  //not used right now, but you might want it
 	maek.CPP('Sound.cpp'),
 	maek.CPP('load_wav.cpp'),
 	maek.CPP('load_opus.cpp'),
-	maek.CPP('Stove.cpp')
+	maek.CPP('Stove.cpp'),
+	maek.CPP('UIBatch.cpp'),
+	maek.CPP('AsyncImage.cpp'),
+	maek.CPP('ScreenCapture.cpp')
 ];
 
 const common_names = [
@@ -175,10 +188,15 @@ const common_names = [
 	maek.CPP('gl_compile_program.cpp'),
 	maek.CPP('Mode.cpp'),
 	maek.CPP('GL.cpp'),
+	maek.CPP('GLState.cpp'),
 	maek.CPP('Load.cpp'),
 	maek.CPP('TextManager.cpp'),
 	maek.CPP('DynamicMeshBuffer.cpp'),
-	maek.CPP('RayCast.cpp')
+	maek.CPP('RayCast.cpp'),
+	maek.CPP('Profiler.cpp'),
+	maek.CPP('TransformAnimation.cpp'),
+	maek.CPP('bone_vertex_color_program.cpp'),
+	maek.CPP('StaticBatch.cpp')
 ];
 
 const show_meshes_names = [
@@ -193,6 +211,31 @@ const show_scene_names = [
 	maek.CPP('ShowSceneMode.cpp')
 ];
 
+//rat update benchmark (not built by default; run 'node Maekfile.js bench/rat-bench'):
+const rat_bench_names = [
+	maek.CPP('rat-bench.cpp'),
+	maek.CPP('Rat.cpp'),
+	maek.CPP('Character.cpp'),
+	maek.CPP('CollisionGrid.cpp'),
+	maek.CPP('JobSystem.cpp')
+];
+
+//ray vs. box test benchmark (not built by default; run 'node Maekfile.js bench/raycast-bench'):
+const raycast_bench_names = [
+	maek.CPP('raycast-bench.cpp')
+];
+
+//renderer benchmark, offscreen (not built by default; run 'node Maekfile.js bench/render-bench'):
+const render_bench_names = [
+	maek.CPP('render-bench.cpp'),
+	maek.CPP('LitColorTextureProgram.cpp')
+];
+
+//animation compression / cross-fade checks (not built by default; run 'node Maekfile.js bench/anim-check'):
+const anim_check_names = [
+	maek.CPP('anim-check.cpp')
+];
+
 //the '[exeFile =] LINK(objFiles, exeFileBase, [, options])' links an array of objects into an executable:
 // objFiles: array of objects to link
 // exeFileBase: name of executable file to produce
@@ -200,6 +243,10 @@ const show_scene_names = [
 const game_exe = maek.LINK([...game_names, ...common_names], 'dist/game');
 const show_meshes_exe = maek.LINK([...show_meshes_names, ...common_names], 'scenes/show-meshes');
 const show_scene_exe = maek.LINK([...show_scene_names, ...common_names], 'scenes/show-scene');
+const rat_bench_exe = maek.LINK([...rat_bench_names, ...common_names], 'bench/rat-bench');
+const raycast_bench_exe = maek.LINK([...raycast_bench_names, ...common_names], 'bench/raycast-bench');
+const render_bench_exe = maek.LINK([...render_bench_names, ...common_names], 'bench/render-bench');
+const anim_check_exe = maek.LINK([...anim_check_names, ...common_names], 'bench/anim-check');
 
 //const freetype_test_exe = maek.LINK([...freetype_test_names], 'freetype-test');
 
@@ -1,5 +1,6 @@
 #include "Mesh.hpp"
 #include "read_write_chunk.hpp"
+#include "GLState.hpp"
 
 #include <glm/glm.hpp>
 
@@ -10,6 +11,7 @@
 #include <string>
 #include <set>
 #include <cstddef>
+#include <cstdlib>
 #include <iostream>
 
 MeshBuffer::MeshBuffer(std::string const &filename) {
@@ -26,24 +28,60 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 		glm::vec2 TexCoord;
 	};
 	static_assert(sizeof(Vertex) == 3*4+3*4+4*1+2*4, "Vertex is packed.");
-	std::vector< Vertex > data;
+
+	//skinned vertices also carry up to four bone influences:
+	struct SkinnedVertex {
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::u8vec4 Color;
+		glm::vec2 TexCoord;
+		glm::vec4 BoneWeights;
+		glm::u8vec4 BoneIndices;
+	};
+	static_assert(sizeof(SkinnedVertex) == 3*4+3*4+4*1+2*4+4*4+4*1, "SkinnedVertex is packed.");
+
+	std::vector< glm::vec3 > positions; //(kept for computing mesh bounds)
 
 	//read + upload data chunk:
 	if (filename.size() >= 5 && filename.substr(filename.size()-5) == ".pnct") {
+		std::vector< Vertex > data;
 		read_chunk(file, "pnct", &data);
 
 		//upload data:
-		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		GLState::bind_buffer(GL_ARRAY_BUFFER, buffer);
 		glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(Vertex), data.data(), GL_STATIC_DRAW);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
 
 		total = GLuint(data.size()); //store total for later checks on index
+		positions.reserve(data.size());
+		for (auto const &v : data) positions.emplace_back(v.Position);
 
 		//store attrib locations:
 		Position = Attrib(3, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, Position));
 		Normal = Attrib(3, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, Normal));
 		Color = Attrib(4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), offsetof(Vertex, Color));
 		TexCoord = Attrib(2, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, TexCoord));
+	} else if (filename.size() >= 5 && filename.substr(filename.size()-5) == ".pncb") {
+		std::vector< SkinnedVertex > data;
+		read_chunk(file, "pncb", &data);
+
+		//upload data:
+		GLState::bind_buffer(GL_ARRAY_BUFFER, buffer);
+		glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(SkinnedVertex), data.data(), GL_STATIC_DRAW);
+		GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
+
+		total = GLuint(data.size()); //store total for later checks on index
+		positions.reserve(data.size());
+		for (auto const &v : data) positions.emplace_back(v.Position);
+
+		//store attrib locations:
+		Position = Attrib(3, GL_FLOAT, GL_FALSE, sizeof(SkinnedVertex), offsetof(SkinnedVertex, Position));
+		Normal = Attrib(3, GL_FLOAT, GL_FALSE, sizeof(SkinnedVertex), offsetof(SkinnedVertex, Normal));
+		Color = Attrib(4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SkinnedVertex), offsetof(SkinnedVertex, Color));
+		TexCoord = Attrib(2, GL_FLOAT, GL_FALSE, sizeof(SkinnedVertex), offsetof(SkinnedVertex, TexCoord));
+		BoneWeights = Attrib(4, GL_FLOAT, GL_FALSE, sizeof(SkinnedVertex), offsetof(SkinnedVertex, BoneWeights));
+		BoneIndices = Attrib(4, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(SkinnedVertex), offsetof(SkinnedVertex, BoneIndices));
+		BoneIndices.integer = true;
 	} else {
 		throw std::runtime_error("Unknown file type '" + filename + "'");
 	}
@@ -74,8 +112,8 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 			mesh.start = entry.vertex_begin;
 			mesh.count = entry.vertex_end - entry.vertex_begin;
 			for (uint32_t v = entry.vertex_begin; v < entry.vertex_end; ++v) {
-				mesh.min = glm::min(mesh.min, data[v].Position);
-				mesh.max = glm::max(mesh.max, data[v].Position);
+				mesh.min = glm::min(mesh.min, positions[v]);
+				mesh.max = glm::max(mesh.max, positions[v]);
 			}
 			bool inserted = meshes.insert(std::make_pair(name, mesh)).second;
 			if (!inserted) {
@@ -84,6 +122,38 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 		}
 	}
 
+	//move "Name@lodN" meshes into Name's LOD chain:
+	for (auto m = meshes.begin(); m != meshes.end(); ) {
+		std::string::size_type at = m->first.rfind("@lod");
+		if (at == std::string::npos) {
+			++m;
+			continue;
+		}
+		std::string base = m->first.substr(0, at);
+		uint32_t level = uint32_t(std::strtoul(m->first.c_str() + at + 4, nullptr, 10));
+		auto f = meshes.find(base);
+		if (level == 0 || f == meshes.end()) {
+			std::cerr << "WARNING: mesh '" << m->first << "' in filename '" << filename << "' looks like a LOD, but has level 0 or no mesh '" << base << "' to belong to." << std::endl;
+			++m;
+			continue;
+		}
+		std::vector< Mesh::LOD > &lods = f->second.lods;
+		if (lods.size() < level) lods.resize(level);
+		lods[level-1].start = m->second.start;
+		lods[level-1].count = m->second.count;
+		m = meshes.erase(m);
+	}
+	for (auto &[name, mesh] : meshes) {
+		//(a missing level ends the chain)
+		for (uint32_t i = 0; i < mesh.lods.size(); ++i) {
+			if (mesh.lods[i].count == 0) {
+				std::cerr << "WARNING: mesh '" << name << "' in filename '" << filename << "' is missing LOD level " << (i+1) << "." << std::endl;
+				mesh.lods.resize(i);
+				break;
+			}
+		}
+	}
+
 	if (file.peek() != EOF) {
 		std::cerr << "WARNING: trailing data in mesh file '" << filename << "'" << std::endl;
 	}
@@ -111,16 +181,20 @@ GLuint MeshBuffer::make_vao_for_program(GLuint program) const {
 	//create a new vertex array object:
 	GLuint vao = 0;
 	glGenVertexArrays(1, &vao);
-	glBindVertexArray(vao);
+	GLState::bind_vertex_array(vao);
 
 	//Try to bind all attributes in this buffer:
 	std::set< GLuint > bound;
-	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, buffer);
 	auto bind_attribute = [&](char const *name, MeshBuffer::Attrib const &attrib) {
 		if (attrib.size == 0) return; //don't bind empty attribs
 		GLint location = glGetAttribLocation(program, name);
 		if (location == -1) return; //can't bind missing attribs
-		glVertexAttribPointer(location, attrib.size, attrib.type, attrib.normalized, attrib.stride, (GLbyte *)0 + attrib.offset);
+		if (attrib.integer) {
+			glVertexAttribIPointer(location, attrib.size, attrib.type, attrib.stride, (GLbyte *)0 + attrib.offset);
+		} else {
+			glVertexAttribPointer(location, attrib.size, attrib.type, attrib.normalized, attrib.stride, (GLbyte *)0 + attrib.offset);
+		}
 		glEnableVertexAttribArray(location);
 		bound.insert(location);
 	};
@@ -128,8 +202,10 @@ GLuint MeshBuffer::make_vao_for_program(GLuint program) const {
 	bind_attribute("Normal", Normal);
 	bind_attribute("Color", Color);
 	bind_attribute("TexCoord", TexCoord);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
+	bind_attribute("BoneWeights", BoneWeights);
+	bind_attribute("BoneIndices", BoneIndices);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
+	GLState::bind_vertex_array(0);
 
 	//Check that all active attributes were bound:
 	GLint active = 0;
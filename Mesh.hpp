@@ -14,6 +14,7 @@
 #include <map>
 #include <limits>
 #include <string>
+#include <vector>
 
 
 struct Mesh {
@@ -27,10 +28,18 @@ struct Mesh {
 	//useful for debug visualization and (perhaps, eventually) collision detection:
 	glm::vec3 min = glm::vec3( std::numeric_limits< float >::infinity());
 	glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+
+	//Simpler versions of this mesh (in the same buffer), coarsest last:
+	// loaded from meshes named "Name@lod1", "Name@lod2", ... (see scenes/make-lods.py)
+	struct LOD {
+		GLuint start = 0;
+		GLuint count = 0;
+	};
+	std::vector< LOD > lods;
 };
 
 struct MeshBuffer {
-	//construct from a file:
+	//construct from a file (.pnct, or .pncb for skinned meshes):
 	// note: will throw if file fails to read.
 	MeshBuffer(std::string const &filename);
 
@@ -60,6 +69,7 @@ struct MeshBuffer {
 		GLboolean normalized = GL_FALSE;
 		GLsizei stride = 0;
 		GLsizei offset = 0;
+		bool integer = false; //bind with glVertexAttribIPointer (e.g., for uvec4 bone indices)
 
 		Attrib() = default;
 		Attrib(GLint size_, GLenum type_, GLboolean normalized_, GLsizei stride_, GLsizei offset_)
@@ -70,4 +80,6 @@ struct MeshBuffer {
 	Attrib Normal;
 	Attrib Color;
 	Attrib TexCoord;
+	Attrib BoneWeights; //(only in skinned '.pncb' files)
+	Attrib BoneIndices;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <SDL3/SDL.h>
 #include <glm/glm.hpp>
 
+#include <functional>
 #include <memory>
 
 struct Mode : std::enable_shared_from_this< Mode > {
@@ -13,13 +14,25 @@ struct Mode : std::enable_shared_from_this< Mode > {
 	//The function should return 'true' if it handled the event.
 	virtual bool handle_event(SDL_Event const &, glm::uvec2 const &window_size) { return false; }
 
-	//update is called at the start of a new frame, after events are handled:
-	// 'elapsed' is time in seconds since the last call to 'update'
+	//update is called after events are handled, zero or more times per frame:
+	// 'elapsed' is the fixed simulation step (in seconds; see main.cpp)
 	virtual void update(float elapsed) { }
 
+	//interpolate is called before draw with the fraction [0,1) of a step that has
+	// accumulated since the last call to 'update'; modes can use this to draw
+	// their state blended between the last two updates:
+	virtual void interpolate(float alpha) { }
+
 	//draw is called after update:
 	virtual void draw(glm::uvec2 const &drawable_size) = 0;
 
+	//when main.cpp runs with a render thread (--render-thread), it calls record instead of draw:
+	// record should save whatever drawing needs from the mode's state and return a function that
+	// makes the GL calls; that function runs on the render thread, possibly while the next update
+	// is running, so it should only use what record saved (see RenderThread.hpp).
+	//Returning an empty function (the default) means "call draw on the render thread and wait for it".
+	virtual std::function< void() > record(glm::uvec2 const &drawable_size) { return nullptr; }
+
 	//Mode::current is the Mode to which events are dispatched.
 	// use 'set_current' to change the current Mode (e.g., to switch to a menu)
 	static std::shared_ptr< Mode > current;
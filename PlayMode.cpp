@@ -4,11 +4,14 @@
 #include "LitColorTextureProgram.hpp"
 
 #include "DrawLines.hpp"
+#include "Profiler.hpp"
 #include "Mesh.hpp"
 #include "Load.hpp"
 #include "gl_errors.hpp"
 #include "data_path.hpp"
 #include "read_write_chunk.hpp"
+#include "GLState.hpp"
+#include "RenderThread.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
 
@@ -17,6 +20,7 @@
 #include <cmath>
 #include <string>
 #include <algorithm>
+#include <unordered_set>
 
 GLuint level_meshes_for_lit_color_texture_program = 0;
 Load<MeshBuffer> level_meshes(LoadTagDefault, []() -> MeshBuffer const *
@@ -43,7 +47,13 @@ Load<Scene> level_scene(LoadTagDefault, []() -> Scene const *
 												 drawable.pipeline.vao = level_meshes_for_lit_color_texture_program;
 												 drawable.pipeline.type = mesh.type;
 												 drawable.pipeline.start = mesh.start;
-												 drawable.pipeline.count = mesh.count; }); });
+												 drawable.pipeline.count = mesh.count;
+
+												 drawable.min = mesh.min;
+												 drawable.max = mesh.max;
+
+												 for (auto const &lod : mesh.lods)
+													 drawable.lods.emplace_back(Scene::Drawable::LOD{lod.start, lod.count}); }); });
 
 Sound::Sample kitchen_first = Sound::Sample(data_path("kitchen_music_first.wav"));
 Sound::Sample kitchen_loop = Sound::Sample(data_path("kitchen_music_loop.wav"));
@@ -59,59 +69,35 @@ PlayMode::PlayMode() : scene(*level_scene), kitchen_music(&kitchen_first, &kitch
 
 	player = new Player(this);
 
-	for (auto &transform : scene.transforms)
-	{
-		std::cout << transform.name << std::endl;
-		if (transform.name == "Wheel_Prototype")
-			player->model = &transform;
-		else if (transform.name == "Cheese_Wheel")
-			player->collision = &transform;
-		else if (transform.name.substr(0, 5) == "Grate")
-		{
-			grates.emplace_back(&transform);
-		}
-		else if (transform.name.substr(0, 9) == "Collision")
-		{
-			collision_platforms.emplace_back(&transform);
-		}
-		else if (transform.name.substr(0, 3) == "Rat")
-		{
-			Rat *rat = new Rat(this);
-			rat->model = &transform;
-			rat->collision = &transform;
-			rats.emplace_back(rat);
-		}
-		else if (transform.name.substr(0, 10) == "BounceWeak")
-		{
-			bouncy_weak_platforms.emplace_back(&transform);
-		}
-		else if (transform.name.substr(0, 12) == "BounceStrong")
-		{
-			bouncy_strong_platforms.emplace_back(&transform);
-		}
-		if (transform.name.substr(0, 5) == "Plate" )
-		{
-			/*if (transform.name == "Plate_hot") stove_1 = &transform;
-			if (transform.name == "Plate_cold") stove_2 = &transform;;*/
-			collision_plates.emplace_back(&transform);
-		}
-	}
+	// level objects, by name tag (see Scene::tag_index):
+	for (auto *transform : scene.tagged("Wheel"))
+		if (transform->name == "Wheel_Prototype")
+			player->model = transform;
+	for (auto *transform : scene.tagged("Cheese"))
+		if (transform->name == "Cheese_Wheel")
+			player->collision = transform;
+	grates = scene.tagged("Grate");
+	collision_platforms = scene.tagged("Collision");
+	bouncy_weak_platforms = scene.tagged("BounceWeak");
+	bouncy_strong_platforms = scene.tagged("BounceStrong");
+	collision_plates = scene.tagged("Plate");
+	for (auto *transform : scene.tagged("Rat"))
+		rats.add(transform);
+
 	if (player->model == nullptr)
 		throw std::runtime_error("Cheese not found.");
 
+	grapple_bvh.build(grapple_crackers, &scene);
+
+	// rats are blocked by everything solid (they don't melt through grates or bounce):
+	rats.set_solids({&collision_plates, &grates, &bouncy_weak_platforms, &bouncy_strong_platforms, &collision_platforms});
+
 	// get pointer to camera for convenience:
 	if (scene.cameras.size() != 1)
 		throw std::runtime_error("Expecting scene to have exactly one camera, but it has " + std::to_string(scene.cameras.size()));
 	camera = &scene.cameras.front();
 
-	for (auto &drawable : scene.drawables)
-	{
-		if (drawable.transform == player->model)
-		{
-			player->drawable = &drawable;
-			break;
-		}
-	}
+	player->drawable = scene.drawable_for(player->model);
 
 	level_meshes->print_all_meshes();
 
@@ -121,6 +107,7 @@ PlayMode::PlayMode() : scene(*level_scene), kitchen_music(&kitchen_first, &kitch
 	player->mesh = &(level_meshes->lookup("Wheel_Prototype"));
 
 	player->theta = player->model->rotation;
+	player->previous_theta = player->theta;
 	const size_t vertex_stride = sizeof(DynamicMeshBuffer::Vertex);
 	const GLintptr offset_bytes = (GLintptr)player->mesh->start * vertex_stride;
 	const GLsizeiptr size_bytes = (GLsizeiptr)player->mesh->count * vertex_stride;
@@ -128,7 +115,7 @@ PlayMode::PlayMode() : scene(*level_scene), kitchen_music(&kitchen_first, &kitch
 	std::cout << player->collision->position.x <<" " << player->collision->position.y << " " << player->collision->position.z << std::endl;
 
 	std::vector<DynamicMeshBuffer::Vertex> initial_vertices(player->mesh->count);
-	glBindBuffer(GL_ARRAY_BUFFER, level_meshes->buffer);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, level_meshes->buffer);
 
 	glGetBufferSubData(
 		GL_ARRAY_BUFFER,
@@ -137,7 +124,7 @@ PlayMode::PlayMode() : scene(*level_scene), kitchen_music(&kitchen_first, &kitch
 		initial_vertices.data() // Destination pointer in CPU memory
 	);
 
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
 
 	player->initialVerticesCpu = initial_vertices;
 	player->verticesCpu = initial_vertices;
@@ -152,26 +139,39 @@ PlayMode::PlayMode() : scene(*level_scene), kitchen_music(&kitchen_first, &kitch
 	player->drawable->pipeline.type = player->mesh->type;
 	player->drawable->pipeline.start = 0; // Starts from 0 in the new buffer
 	player->drawable->pipeline.count = player->mesh->count;
+	// (the level's LOD ranges index Cheese.pnct, not the cheese buffer, so always draw full detail)
+	player->drawable->lods.clear();
 
-	wine_bottle_ui.load_image_data(data_path("wine_bottle_5.png"), OriginLocation::UpperLeftOrigin);
-	wine_bottle_ui.create_mesh(Mode::window, bottle_ui_pos_x, bottle_ui_pos_y, bottle_ui_height);
+	for (uint32_t rank = 0; rank < 6; ++rank) {
+		wine_bottle_images[rank] = ui.add_image(data_path("wine_bottle_" + std::to_string(rank) + ".png"));
+	}
+	wine_bottle_quad = ui.add_quad(wine_bottle_images[5], glm::vec2(bottle_ui_pos_x, bottle_ui_pos_y), bottle_ui_height);
 
 	// kitchen_music = DynamicSoundLoop::DynamicSoundLoop();
 	kitchen_music.play(1.0f, 0.0f);
 	pause_music.play(0.0f, 0.0f);
 
 	stove.init(scene);
+
+	// merge the level geometry that never moves (everything but the cheese, rats, and stove parts):
+	std::unordered_set<Scene::Transform const *> dynamic(rats.transforms.begin(), rats.transforms.end());
+	dynamic.insert(player->model);
+	for (auto *transform : scene.tagged("Switch"))
+		dynamic.insert(transform);
+	for (auto *transform : scene.tagged("Plate"))
+		dynamic.insert(transform);
+	static_batches.build(&scene, *level_meshes, level_meshes_for_lit_color_texture_program, dynamic);
 }
 
 PlayMode::~PlayMode()
 {
-	glDeleteVertexArrays(1, &player->cheese_lit_color_texture_program);
+	GLState::delete_vertex_arrays(1, &player->cheese_lit_color_texture_program);
 	player->cheese_lit_color_texture_program = 0;
 
-	if (stove_tint_lvl0) glDeleteTextures(1, &stove_tint_lvl0);
-	if (stove_tint_lvl1) glDeleteTextures(1, &stove_tint_lvl1);
-	if (stove_tint_lvl2) glDeleteTextures(1, &stove_tint_lvl2);
-	if (stove_tint_lvl3) glDeleteTextures(1, &stove_tint_lvl3);
+	if (stove_tint_lvl0) GLState::delete_textures(1, &stove_tint_lvl0);
+	if (stove_tint_lvl1) GLState::delete_textures(1, &stove_tint_lvl1);
+	if (stove_tint_lvl2) GLState::delete_textures(1, &stove_tint_lvl2);
+	if (stove_tint_lvl3) GLState::delete_textures(1, &stove_tint_lvl3);
 
 	Sound::stop_all_samples();
 
@@ -283,33 +283,6 @@ bool PlayMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size)
 			last_ray = r;
 			has_last_ray = true;
 
-			Scene::Transform *hit = nullptr;
-			float best_t = std::numeric_limits<float>::max();
-
-			auto try_hit = [&](Scene::Transform *t)
-			{
-				if (!t)
-					return;
-				glm::vec3 c, h;
-				world_box(t, c, h);
-				/*std::cout << "[bounding box] " << t->name << " C=(" << c.x << "," << c.y << "," << c.z
-					<< ") H=(" << h.x << "," << h.y << "," << h.z << ")\n";*/
-				float tval;
-				if (ray_box_intersect(r, c, h, &tval) && tval < best_t)
-				{
-					std::cout << "  -> HIT at t=" << tval << "\n";
-					if (tval < best_t)
-					{
-						best_t = tval;
-						hit = t;
-					}
-				}
-				else
-				{
-					std::cout << "  -> miss\n";
-				}
-			};
-
 			//int new_level = 0;
 			if (stove.try_toggle(r, nullptr)) {
 				//player->set_heat_level(new_level);
@@ -318,13 +291,10 @@ bool PlayMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size)
 
 
 			if (player->melt_level > (player->MELT_MIN + player->MELT_MAX) / 2) {
-				for (auto cracker : grapple_crackers) {
-					try_hit(cracker);
-
-					if (hit) {
-						player->grapple_point = cracker;
-						player->locomotionState = (Player::PlayerLocomotion)(player->locomotionState | Player::PlayerLocomotion::Grappling);
-					}
+				RayHit hit;
+				if (grapple_bvh.closest_hit(r, &hit)) {
+					player->grapple_point = hit.transform;
+					player->locomotionState = (Player::PlayerLocomotion)(player->locomotionState | Player::PlayerLocomotion::Grappling);
 				}
 			}
 		}
@@ -333,8 +303,28 @@ bool PlayMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size)
 	return false;
 }
 
+void PlayMode::snapshot_transforms(std::vector<TransformState> *into_)
+{
+	auto &into = *into_;
+	into.clear();
+	into.reserve(scene.transforms.size());
+	for (auto &transform : scene.transforms)
+	{
+		into.emplace_back(TransformState{&transform, transform.position, transform.rotation, transform.scale});
+	}
+}
+
+void PlayMode::interpolate(float alpha)
+{
+	render_alpha = alpha;
+}
+
 void PlayMode::update(float elapsed)
 {
+	// remember where everything was, so draw can blend toward where it ends up:
+	snapshot_transforms(&previous_transforms);
+	player->previous_theta = player->theta;
+
 	if (player->pause.downs > 0) {
 		paused = !paused;
 		if (paused) {
@@ -354,8 +344,7 @@ void PlayMode::update(float elapsed)
 		}
 
 
-		for (Rat *rat : rats)
-			rat->update(elapsed);
+		rats.update(elapsed, player->collision->position);
 
 		camera->transform->position.y = player->collision->position.y; // need to change this
 		camera->transform->position.z = player->collision->position.z + 30.0f;						   // need to change this
@@ -368,8 +357,7 @@ void PlayMode::update(float elapsed)
 		// std::cout << wine_rank << std::endl;
 
 		if (wine_rank != last_rank) {
-			wine_bottle_ui.load_image_data(data_path("wine_bottle_" + std::to_string(wine_rank) + ".png"), OriginLocation::UpperLeftOrigin);
-			wine_bottle_ui.create_mesh(Mode::window, bottle_ui_pos_x, bottle_ui_pos_y, bottle_ui_height);
+			ui.set_image(wine_bottle_quad, wine_bottle_images[std::clamp(wine_rank, 0, 5)]);
 		}
 	}
 
@@ -386,6 +374,30 @@ void PlayMode::update(float elapsed)
 
 void PlayMode::draw(glm::uvec2 const &drawable_size)
 {
+	Frame &frame = frames[0];
+	record_frame(drawable_size, &frame);
+	render_frame(frame);
+}
+
+std::function<void()> PlayMode::record(glm::uvec2 const &drawable_size)
+{
+	// (RenderThread only lets one frame be in flight, so the other frame is free to record into)
+	Frame &frame = frames[next_frame];
+	next_frame = (next_frame + 1) % uint32_t(frames.size());
+	record_frame(drawable_size, &frame);
+
+	// (main.cpp keeps a reference to this mode until the frame is drawn)
+	return [this, &frame]()
+	{
+		render_frame(frame);
+	};
+}
+
+void PlayMode::record_frame(glm::uvec2 const &drawable_size, Frame *frame_)
+{
+	PROFILE_SCOPE("PlayMode::record_frame");
+	Frame &frame = *frame_;
+	frame.drawable_size = drawable_size;
 
 	// update camera aspect ratio for drawable:
 	camera->aspect = float(drawable_size.x) / float(drawable_size.y);
@@ -393,28 +405,83 @@ void PlayMode::draw(glm::uvec2 const &drawable_size)
 	// for mouse
 	last_drawable_px = drawable_size;
 
-	// set up light type and position for lit_color_texture_program:
-	//  TODO: consider using the Light(s) in the scene to do this
-	glUseProgram(lit_color_texture_program->program);
-	glUniform1i(lit_color_texture_program->LIGHT_TYPE_int, 1);
-	glUniform3fv(lit_color_texture_program->LIGHT_DIRECTION_vec3, 1, glm::value_ptr(glm::vec3(0.0f, 0.0f, -1.0f)));
-	glUniform3fv(lit_color_texture_program->LIGHT_ENERGY_vec3, 1, glm::value_ptr(glm::vec3(1.0f, 1.0f, 0.95f)));
-	glUseProgram(0);
+	// cheese mesh deformation is only needed once per drawn frame:
+	player->deform_mesh(render_alpha);
+	// (swap rather than copy -- deform_mesh rewrites all of verticesCpu anyway)
+	std::swap(frame.cheese_vertices, player->verticesCpu);
+
+	// draw transforms blended between the last two updates, then put them back:
+	// (previous_transforms is empty until the first update)
+	bool blend = !previous_transforms.empty() && previous_transforms.size() == scene.transforms.size();
+	if (blend)
+	{
+		snapshot_transforms(&current_transforms);
+		for (size_t i = 0; i < current_transforms.size(); ++i)
+		{
+			TransformState const &prev = previous_transforms[i];
+			TransformState const &cur = current_transforms[i];
+			assert(prev.transform == cur.transform);
+			cur.transform->position = glm::mix(prev.position, cur.position, render_alpha);
+			cur.transform->rotation = glm::slerp(prev.rotation, cur.rotation, render_alpha);
+			cur.transform->scale = glm::mix(prev.scale, cur.scale, render_alpha);
+		}
+	}
+
+	// lights for lit_color_texture_program (after blending, so they move with what they're attached to):
+	LightClusters &lights = frame.lights;
+	lights.clear();
+	bool has_sky = false;
+	for (auto const &light : scene.lights)
+	{
+		lights.add(light);
+		has_sky = has_sky || light.type == Scene::Light::Hemisphere || light.type == Scene::Light::Directional;
+	}
+	if (!has_sky)
+	{
+		// the level's default overhead light:
+		lights.add(Scene::Light::Hemisphere, glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(1.0f, 1.0f, 0.95f));
+	}
+	// hot stove plates glow (brighter with level):
+	for (Scene::Transform *plate : stove.hot_plates())
+	{
+		glm::vec3 position = plate->make_world_from_local()[3];
+		float level = float(stove.get_level_for_plate(plate));
+		lights.add(Scene::Light::Point, position + glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), level * glm::vec3(3.0f, 1.0f, 0.35f));
+	}
+	lights.bin(*camera, drawable_size);
+
+	scene.record(*camera, &frame.scene);
 
+	if (blend)
+	{
+		for (auto const &cur : current_transforms)
+		{
+			cur.transform->position = cur.position;
+			cur.transform->rotation = cur.rotation;
+			cur.transform->scale = cur.scale;
+		}
+	}
+
+	frame.ui_quads = ui.quads;
+}
+
+void PlayMode::render_frame(Frame &frame)
+{
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 	glClearDepth(1.0f); // 1.0 is actually the default value to clear the depth buffer to, but FYI you can change it.
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-	glEnable(GL_DEPTH_TEST);
+	GLState::enable(GL_DEPTH_TEST);
 	glDepthFunc(GL_LESS); // this is the default depth comparison function, but FYI you can change it.
 
-	scene.draw(*camera);
+	player->initialMeshBuffer.set(frame.cheese_vertices, GL_DYNAMIC_DRAW);
 
-	assert(wine_bottle_ui.data_created);
-	if (wine_bottle_ui.data_created)
-		wine_bottle_ui.draw_mesh();
+	frame.lights.upload();
+	frame.lights.bind();
 
+	Scene::draw(frame.scene);
 
+	ui.draw(frame.drawable_size, frame.ui_quads);
 
 	GL_ERRORS();
 }
@@ -424,5 +491,7 @@ void PlayMode::reset()
 	// player->collision->position = glm::vec3(0.0f, 77.41f, 30.301f);
 	// player->locomotionState = (Player::PlayerLocomotion)0;
 	// player->dead = false;
-	Mode::set_current(std::make_shared<PlayMode>());
+	// (modes own GL objects, so are made -- and the old one destroyed -- on the GL thread)
+	RenderThread::run_on_gl_thread([]()
+								   { Mode::set_current(std::make_shared<PlayMode>()); });
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include <glm/glm.hpp>
 
+#include <array>
 #include <vector>
 #include <deque>
 #include <cmath>
@@ -12,13 +13,15 @@
 #include "Sound.hpp"
 #include "DynamicSoundLoop.hpp"
 #include "TextManager.hpp"
-#include "UIElement.hpp"
+#include "UIBatch.hpp"
 #include "DynamicMeshBuffer.hpp"
 #include "RayCast.hpp"
 #include "Player.hpp"
 #include "Rat.hpp"
 #include "Mesh.hpp"
 #include "Stove.hpp"
+#include "LitColorTextureProgram.hpp"
+#include "StaticBatch.hpp"
 
 struct PlayMode : Mode
 {
@@ -28,11 +31,43 @@ struct PlayMode : Mode
 	// functions called by main loop:
 	virtual bool handle_event(SDL_Event const &, glm::uvec2 const &window_size) override;
 	virtual void update(float elapsed) override;
+	virtual void interpolate(float alpha) override;
 	virtual void draw(glm::uvec2 const &drawable_size) override;
+	virtual std::function< void() > record(glm::uvec2 const &drawable_size) override;
 
 	// Resets the game state
 	void reset();
 
+	//----- render interpolation -----
+	// (update runs at a fixed rate; draw blends transforms between the last two updates)
+
+	struct TransformState {
+		Scene::Transform *transform = nullptr;
+		glm::vec3 position;
+		glm::quat rotation;
+		glm::vec3 scale;
+	};
+	std::vector<TransformState> previous_transforms; // all scene transforms as of the start of the last update
+	std::vector<TransformState> current_transforms;	 // scratch space used to restore transforms after drawing
+	float render_alpha = 1.0f;						 // fraction of a step since the last update
+	void snapshot_transforms(std::vector<TransformState> *into);
+
+	//----- recorded frames -----
+	// (draw is record_frame then render_frame; with a render thread, record_frame runs on the
+	//  main thread and render_frame on the render thread, alternating between the two frames)
+
+	struct Frame {
+		glm::uvec2 drawable_size = glm::uvec2(0);
+		Scene::DrawList scene;									// drawables, world matrices, LODs, camera
+		LightClusters lights;									// scene lights + stove glow, binned (uploaded by render_frame)
+		std::vector<DynamicMeshBuffer::Vertex> cheese_vertices; // deformed cheese mesh
+		std::vector<UIBatch::Quad> ui_quads;
+	};
+	std::array<Frame, 2> frames;
+	uint32_t next_frame = 0;
+	void record_frame(glm::uvec2 const &drawable_size, Frame *frame);
+	void render_frame(Frame &frame);
+
 	//----- game state -----
 
 	//struct Ray {
@@ -61,8 +96,10 @@ struct PlayMode : Mode
 	std::vector<Scene::Transform *> bouncy_weak_platforms;
 	std::vector<Scene::Transform *> bouncy_strong_platforms;
 	std::vector<Scene::Transform *> grapple_crackers;
-	std::vector<Rat *> rats;
+	RayBVH grapple_bvh; // grapple_crackers, for picking
+	RatSystem rats;
 	StoveSystem stove;
+	StaticBatches static_batches; // everything else that never moves
 
 	Player *player = nullptr;
 
@@ -89,7 +126,9 @@ struct PlayMode : Mode
 	// Game Timer (+UI)
 	float MAX_LEVEL_TIME = 120.0f; // TODO: A struct of some level class
 	float wine_remaining = MAX_LEVEL_TIME;
-	UIElement wine_bottle_ui;
+	UIBatch ui;
+	uint32_t wine_bottle_images[6] = {0, 0, 0, 0, 0, 0}; //indexed by wine rank (0 = empty, 5 = full)
+	uint32_t wine_bottle_quad = 0;
 	float bottle_ui_pos_x = 0.9f;
 	float bottle_ui_pos_y = 0.6f;
 	float bottle_ui_height = 0.8f;
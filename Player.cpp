@@ -2,6 +2,8 @@
 #include "PlayMode.hpp"
 
 #include "Mode.hpp"
+#include "Profiler.hpp"
+#include "JobSystem.hpp"
 #include "iostream"
 #include <algorithm>
 
@@ -13,6 +15,8 @@ Player::Player(PlayMode *_game) : Character(_game)
 
 void Player::update(float elapsed)
 {
+	PROFILE_SCOPE("Player::update");
+
 	// combine inputs into a move:
 	if (!(locomotionState & PlayerLocomotion::Grappling)) {
 		if (left.pressed && !right.pressed)
@@ -51,16 +55,21 @@ void Player::update(float elapsed)
 		speed.z += tension[1];
 	}
 
-	applySpeed(elapsed);
+	{
+		// grates only block the cheese until it is melted enough to go through:
+		static std::vector<Scene::Transform *> const no_colliders;
+		bool grates_solid = !(melt_level > (MELT_MIN + MELT_MAX) / 2);
+		applySpeed(elapsed, {&game->collision_plates, grates_solid ? &game->grates : &no_colliders, &game->collision_platforms});
+	}
 
 	// Resolve collisions with the player
 	if (!noclip)
 	{
 		platform = nullptr;
 
-		for (Rat *rat : game->rats)
+		for (Scene::Transform *rat : game->rats.transforms)
 		{
-			if (collide(rat->collision, true))
+			if (collide(rat, true))
 			{
 				std::cout << "DEAD" << std::endl;
 				std::cout.flush();
@@ -145,20 +154,28 @@ void Player::update(float elapsed)
 		}
 	}
 
-	//----------------------------------------
+	wave_acc += elapsed / 5.0f; // 5 second wave animation cycle
+	wave_acc -= std::floor(wave_acc);
+
+	// pause.pressed = false;
+}
+
+void Player::deform_mesh(float alpha)
+{
 	{ //
+		PROFILE_SCOPE("Player mesh rebuild");
 		float cheese_base = mesh->min.z;
 		float cheese_top = mesh->max.z;
 		float height_range = cheese_top - cheese_base;
-		wave_acc += elapsed / 5.0f; // 5 second wave animation cycle
-		wave_acc -= std::floor(wave_acc);
 		float cheese_spread = 1.0f;
 
+		// rotation blended between the last two simulation steps:
+		glm::quat draw_theta = glm::slerp(previous_theta, theta, alpha);
+
 		// Target Brown (e.g., RGB: 139, 69, 19)
 		constexpr glm::vec4 TARGET_BROWN = glm::vec4(60.0f, 10.0f, 2.0f, 255.0f);
 
 		verticesCpu = initialVerticesCpu;
-		initialMeshBuffer.set(initialVerticesCpu.data(), verticesCpu.size(), GL_DYNAMIC_DRAW);
 
 		float melt_percentage_level = 0.5f + (MELT_MAX - melt_level) / MELT_MAX;
 		melt_percentage_level = std::clamp(melt_percentage_level, 0.0f, 1.0f);
@@ -167,61 +184,62 @@ void Player::update(float elapsed)
 		float flow = (1.0f + melt_factor * cheese_spread);
 
 		// Gemnin chat
-		for (auto &vertex : verticesCpu)
-		{
-			vertex.Position = vertex.Position * theta;
-			glm::vec3 pos = vertex.Position;
-			glm::vec4 original_color_f = glm::vec4(vertex.Color); // Already 0-255 range
-
-			float melt_level_z = ((pos.z - cheese_base) * melt_percentage_level) + cheese_base;
-
-			float melt_z_percent = ((pos.z - cheese_base) / (height_range));
-
-			float r = std::hypot(pos.x, pos.y) + 0.01f;
-			float sin_arg = float((r * 0.25f + wave_acc) * (2.0f * M_PI));
-			float h = std::sin(sin_arg);
-			float wave_amplitude = 0.00f; // Adjust this value to change the wave height
-
-			float dh_dr = float(0.25f * 2.0f * M_PI * std::cos(sin_arg));
-			if (melt_z_percent < melt_factor)
+		// every vertex is deformed independently, so split the mesh across threads:
+		JobSystem::parallel_for(verticesCpu.size(), 1024, [&](size_t begin, size_t end) {
+			for (size_t v = begin; v < end; ++v)
 			{
-				vertex.Position.x = (1.0f + flow) * vertex.Position.x;
-				vertex.Position.y = (1.0f + flow) * vertex.Position.y;
-				// Lerp (Interpolate): new_color = (1.0 - factor) * start_color + factor * end_color
-				glm::vec4 final_color_f = glm::mix(original_color_f, TARGET_BROWN, (1.0f - (melt_factor * melt_factor)));
-
-				// Assign the result back to the vertex (rounding the floats to integers)
-				vertex.Color = glm::u8vec4(final_color_f);
-				vertex.Position.z = cheese_base + 0.1f + (melt_percentage_level)*std::abs(0 * h * wave_amplitude);
-
-				// Apply deformation to the Z component (vertical axis for the cheese wheel)
-				// Adjust the multiplier for the desired wave intensity0
+				auto &vertex = verticesCpu[v];
+				vertex.Position = vertex.Position * draw_theta;
+				glm::vec3 pos = vertex.Position;
+				glm::vec4 original_color_f = glm::vec4(vertex.Color); // Already 0-255 range
+
+				float melt_level_z = ((pos.z - cheese_base) * melt_percentage_level) + cheese_base;
+
+				float melt_z_percent = ((pos.z - cheese_base) / (height_range));
+
+				float r = std::hypot(pos.x, pos.y) + 0.01f;
+				float sin_arg = float((r * 0.25f + wave_acc) * (2.0f * M_PI));
+				float h = std::sin(sin_arg);
+				float wave_amplitude = 0.00f; // Adjust this value to change the wave height
+
+				float dh_dr = float(0.25f * 2.0f * M_PI * std::cos(sin_arg));
+				if (melt_z_percent < melt_factor)
+				{
+					vertex.Position.x = (1.0f + flow) * vertex.Position.x;
+					vertex.Position.y = (1.0f + flow) * vertex.Position.y;
+					// Lerp (Interpolate): new_color = (1.0 - factor) * start_color + factor * end_color
+					glm::vec4 final_color_f = glm::mix(original_color_f, TARGET_BROWN, (1.0f - (melt_factor * melt_factor)));
+
+					// Assign the result back to the vertex (rounding the floats to integers)
+					vertex.Color = glm::u8vec4(final_color_f);
+					vertex.Position.z = cheese_base + 0.1f + (melt_percentage_level)*std::abs(0 * h * wave_amplitude);
+
+					// Apply deformation to the Z component (vertical axis for the cheese wheel)
+					// Adjust the multiplier for the desired wave intensity0
+				}
+				else
+				{
+
+					// Deform the position:
+					vertex.Position.z = melt_level_z + 0.1f + (melt_percentage_level)*std::abs(0 * h * wave_amplitude);
+				}
+
+				// Deform the normal (assuming the wave is propagating in the XY plane):
+
+				// Recalculate derivative parts for the new normal vector:
+				// dr/dx = x / r; dr/dy = y / r (from r = sqrt(x^2 + y^2))
+				float dr_dx = pos.x / r;
+				float dr_dy = pos.y / r;
+
+				// Tangent vectors (dp_dx, dp_dy) for the surface:
+				glm::vec3 dp_dx = glm::vec3(1.0f, 0.0f, dh_dr * dr_dx * wave_amplitude);
+				glm::vec3 dp_dy = glm::vec3(0.0f, 1.0f, dh_dr * dr_dy * wave_amplitude);
+
+				// New normal is the cross product of the tangent vectors:
+				vertex.Normal = glm::normalize(glm::cross(dp_dx, dp_dy));
 			}
-			else
-			{
-
-				// Deform the position:
-				vertex.Position.z = melt_level_z + 0.1f + (melt_percentage_level)*std::abs(0 * h * wave_amplitude);
-			}
-
-			// Deform the normal (assuming the wave is propagating in the XY plane):
-
-			// Recalculate derivative parts for the new normal vector:
-			// dr/dx = x / r; dr/dy = y / r (from r = sqrt(x^2 + y^2))
-			float dr_dx = pos.x / r;
-			float dr_dy = pos.y / r;
-
-			// Tangent vectors (dp_dx, dp_dy) for the surface:
-			glm::vec3 dp_dx = glm::vec3(1.0f, 0.0f, dh_dr * dr_dx * wave_amplitude);
-			glm::vec3 dp_dy = glm::vec3(0.0f, 1.0f, dh_dr * dr_dy * wave_amplitude);
-
-			// New normal is the cross product of the tangent vectors:
-			vertex.Normal = glm::normalize(glm::cross(dp_dx, dp_dy));
-		}
-		initialMeshBuffer.set(verticesCpu.data(), verticesCpu.size(), GL_DYNAMIC_DRAW);
+		});
 	}
-
-	// pause.pressed = false;
 }
 
 void Player::set_heat_level(int level) {
@@ -56,6 +56,7 @@ struct Player : public Character
 
     // Angle to rotate the player
 	glm::quat theta;
+	glm::quat previous_theta; // theta before the most recent update, for interpolation
 
     //dynamic mesh data:
 	DynamicMeshBuffer initialMeshBuffer;
@@ -72,4 +73,9 @@ struct Player : public Character
 	float wave_acc = 0.0f;
 
     void update(float elapsed) override;
+
+    // rebuild the deformed cheese mesh (into verticesCpu); called once per drawn frame (not per simulation step):
+    // 'alpha' blends rotation between the previous and current update
+    // (doesn't touch GL -- the caller uploads verticesCpu to initialMeshBuffer)
+    void deform_mesh(float alpha);
 };
\ No newline at end of file
@@ -0,0 +1,461 @@
+#include "Profiler.hpp"
+
+#include "DrawLines.hpp"
+#include "GL.hpp"
+#include "gl_errors.hpp"
+#include "GLState.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+bool Profiler::overlay_visible = false;
+bool Profiler::gpu_scopes_enabled = true;
+
+//---------------- internal state ----------------
+
+namespace {
+	//frames of per-name totals kept for the overlay:
+	constexpr uint32_t Window = 240;
+	//frames of individual scopes kept for export (~10 seconds at 60Hz):
+	constexpr size_t HistoryFrames = 600;
+	//frame-time histogram buckets (for the overlay):
+	constexpr uint32_t HistogramBuckets = 16;
+	constexpr float HistogramBucketMs = 2.5f;
+
+	struct Event {
+		char const *name;
+		uint32_t thread;
+		uint32_t depth;
+		uint64_t start; //microseconds since profiler start
+		uint64_t duration; //microseconds
+	};
+
+	struct GPUResult {
+		char const *name;
+		uint64_t submitted; //CPU time at which the query was begun (microseconds since profiler start)
+		double ms;
+	};
+
+	struct FrameRecord {
+		uint64_t index = 0;
+		uint64_t start = 0;
+		uint64_t duration = 0;
+		std::vector< Event > events;
+		std::vector< GPUResult > gpu; //filled in as query results arrive
+	};
+
+	struct PendingQuery {
+		uint64_t frame;
+		char const *name;
+		uint64_t submitted;
+		GLuint query;
+	};
+
+	//rolling per-name totals, indexed by frame % Window:
+	struct Stat {
+		std::array< float, Window > cpu_ms{};
+		std::array< float, Window > gpu_ms{};
+		bool has_gpu = false;
+	};
+
+	//rolling per-frame totals of a counter, indexed by frame % Window:
+	struct Counter {
+		double current = 0.0; //total so far this frame
+		std::array< float, Window > values{};
+	};
+
+	struct State {
+		std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+		std::mutex mutex; //guards 'events' and 'counters' (scopes may close and counts may come from any thread)
+		std::vector< Event > events; //closed during the current frame
+		std::map< std::string, Counter > counters;
+
+		uint64_t frame = 0; //index of current frame
+		uint64_t frame_start = 0;
+		std::array< float, Window > frame_ms{};
+		std::deque< FrameRecord > history;
+
+		//keyed by name contents, since the same literal may have different addresses in different translation units:
+		std::map< std::string, Stat > stats;
+
+		//GL thread only:
+		bool gpu_scope_open = false;
+		std::vector< GLuint > free_queries;
+		std::deque< PendingQuery > pending_queries;
+	};
+
+	State &get_state() {
+		static State state;
+		return state;
+	}
+
+	std::atomic< uint32_t > next_thread{0};
+	thread_local uint32_t thread_index = next_thread.fetch_add(1);
+	thread_local uint32_t thread_depth = 0;
+
+	uint64_t now_us() {
+		return uint64_t(std::chrono::duration_cast< std::chrono::microseconds >(std::chrono::steady_clock::now() - get_state().epoch).count());
+	}
+
+	//read back any finished timer queries (never waits):
+	void collect_gpu_results() {
+		State &state = get_state();
+		while (!state.pending_queries.empty()) {
+			PendingQuery const &pending = state.pending_queries.front();
+			GLint available = 0;
+			glGetQueryObjectiv(pending.query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) break; //queries complete in order, so later ones aren't done either
+			GLuint64 ns = 0;
+			glGetQueryObjectui64v(pending.query, GL_QUERY_RESULT, &ns);
+			double ms = double(ns) / 1.0e6;
+
+			if (pending.frame + Window > state.frame) {
+				Stat &stat = state.stats[pending.name];
+				stat.gpu_ms[pending.frame % Window] += float(ms);
+				stat.has_gpu = true;
+			}
+			if (!state.history.empty() && pending.frame >= state.history.front().index) {
+				size_t at = size_t(pending.frame - state.history.front().index);
+				if (at < state.history.size()) {
+					state.history[at].gpu.emplace_back(GPUResult{pending.name, pending.submitted, ms});
+				}
+			}
+
+			state.free_queries.emplace_back(pending.query);
+			state.pending_queries.pop_front();
+		}
+	}
+
+	struct Summary {
+		float avg = 0.0f;
+		float max = 0.0f;
+	};
+	Summary summarize(std::array< float, Window > const &values, uint32_t count) {
+		Summary summary;
+		if (count == 0) return summary;
+		float sum = 0.0f;
+		for (uint32_t i = 0; i < count; ++i) {
+			sum += values[i];
+			summary.max = std::max(summary.max, values[i]);
+		}
+		summary.avg = sum / float(count);
+		return summary;
+	}
+
+	std::string json_escape(char const *str) {
+		std::string ret;
+		for (char const *c = str; *c; ++c) {
+			if (*c == '"' || *c == '\\') ret += '\\';
+			ret += *c;
+		}
+		return ret;
+	}
+}
+
+//---------------- scopes ----------------
+
+Profiler::CPUScope::CPUScope(char const *name_) : name(name_), start(now_us()) {
+	thread_depth += 1;
+}
+
+Profiler::CPUScope::~CPUScope() {
+	uint64_t end = now_us();
+	thread_depth -= 1;
+	State &state = get_state();
+	std::unique_lock< std::mutex > lock(state.mutex);
+	state.events.emplace_back(Event{name, thread_index, thread_depth, start, end - start});
+}
+
+Profiler::GPUScope::GPUScope(char const *name) {
+	State &state = get_state();
+	if (!gpu_scopes_enabled) return;
+	if (state.gpu_scope_open) return; //GL_TIME_ELAPSED queries can't nest
+	state.gpu_scope_open = true;
+
+	if (state.free_queries.empty()) {
+		state.free_queries.emplace_back(0);
+		glGenQueries(1, &state.free_queries.back());
+	}
+	query = state.free_queries.back();
+	state.free_queries.pop_back();
+
+	glBeginQuery(GL_TIME_ELAPSED, query);
+	state.pending_queries.emplace_back(PendingQuery{state.frame, name, now_us(), query});
+}
+
+Profiler::GPUScope::~GPUScope() {
+	if (query == 0) return;
+	glEndQuery(GL_TIME_ELAPSED);
+	get_state().gpu_scope_open = false;
+}
+
+//---------------- counters ----------------
+
+void Profiler::count(char const *name, double amount) {
+	State &state = get_state();
+	std::unique_lock< std::mutex > lock(state.mutex);
+	state.counters[name].current += amount;
+}
+
+//---------------- frames ----------------
+
+void Profiler::begin_frame() {
+	State &state = get_state();
+	state.frame_start = now_us();
+	collect_gpu_results();
+}
+
+void Profiler::end_frame() {
+	State &state = get_state();
+	uint64_t end = now_us();
+
+#ifdef GL_PROFILE
+	//per-entry-point totals from the instrumented GL wrappers (see make-GL.py), as counters:
+	{
+		size_t count = 0;
+		GLProfileEntry const *entries = gl_profile_entries(&count);
+		for (size_t i = 0; i < count; ++i) {
+			GLProfileEntry const &entry = entries[i];
+			if (entry.calls == 0) continue;
+			std::string name = entry.name;
+			Profiler::count((name + " calls").c_str(), double(entry.calls));
+			Profiler::count((name + " us").c_str(), double(entry.nanoseconds) / 1000.0);
+			if (entry.bytes != 0) Profiler::count((name + " bytes").c_str(), double(entry.bytes));
+		}
+		gl_profile_reset();
+	}
+#endif
+
+	FrameRecord record;
+	record.index = state.frame;
+	record.start = state.frame_start;
+	record.duration = end - state.frame_start;
+	{
+		std::unique_lock< std::mutex > lock(state.mutex);
+		record.events.swap(state.events);
+		for (auto &[name, counter] : state.counters) {
+			counter.values[state.frame % Window] = float(counter.current);
+			counter.current = 0.0;
+		}
+	}
+
+	//per-name totals for this frame (gpu totals for this frame arrive later, so clear their slot now):
+	uint32_t slot = uint32_t(state.frame % Window);
+	for (auto &[name, stat] : state.stats) {
+		stat.cpu_ms[slot] = 0.0f;
+		stat.gpu_ms[slot] = 0.0f;
+	}
+	for (auto const &event : record.events) {
+		state.stats[event.name].cpu_ms[slot] += float(event.duration) / 1000.0f;
+	}
+	state.frame_ms[slot] = float(record.duration) / 1000.0f;
+
+	state.history.emplace_back(std::move(record));
+	while (state.history.size() > HistoryFrames) state.history.pop_front();
+
+	state.frame += 1;
+}
+
+//---------------- overlay ----------------
+
+void Profiler::draw_overlay(glm::uvec2 const &drawable_size) {
+	if (!overlay_visible) return;
+	if (drawable_size.x == 0 || drawable_size.y == 0) return;
+	PROFILE_SCOPE("Profiler::draw_overlay");
+
+	State &state = get_state();
+	uint32_t count = uint32_t(std::min< uint64_t >(state.frame, Window));
+	if (count == 0) return;
+
+	//draw in pixel coordinates, origin at the lower left:
+	glm::mat4 pixel_to_clip = glm::mat4(
+		glm::vec4(2.0f / float(drawable_size.x), 0.0f, 0.0f, 0.0f),
+		glm::vec4(0.0f, 2.0f / float(drawable_size.y), 0.0f, 0.0f),
+		glm::vec4(0.0f, 0.0f, 1.0f, 0.0f),
+		glm::vec4(-1.0f, -1.0f, 0.0f, 1.0f)
+	);
+
+	GLState::disable(GL_DEPTH_TEST);
+	{
+		DrawLines lines(pixel_to_clip);
+
+		constexpr float Margin = 10.0f;
+		constexpr float TextHeight = 14.0f;
+		constexpr float GraphHeight = 80.0f;
+		constexpr float MsScale = GraphHeight / 50.0f; //pixels per millisecond (graph tops out at 50ms)
+		glm::u8vec4 const white(0xff, 0xff, 0xff, 0xff);
+		glm::u8vec4 const gray(0x88, 0x88, 0x88, 0xff);
+		glm::u8vec4 const green(0x44, 0xff, 0x44, 0xff);
+		glm::u8vec4 const yellow(0xff, 0xdd, 0x44, 0xff);
+		glm::u8vec4 const red(0xff, 0x44, 0x44, 0xff);
+		auto text = [&](std::string const &str, glm::vec2 const &at, glm::u8vec4 const &color) {
+			lines.draw_text(str, glm::vec3(at, 0.0f), glm::vec3(TextHeight, 0.0f, 0.0f), glm::vec3(0.0f, TextHeight, 0.0f), color);
+		};
+		auto ms_color = [&](float ms) {
+			return (ms < 1000.0f / 60.0f ? green : (ms < 1000.0f / 30.0f ? yellow : red));
+		};
+
+		float top = float(drawable_size.y) - Margin;
+
+		//frame-time graph (oldest on the left), with 60Hz / 30Hz reference lines:
+		glm::vec2 graph_min(Margin, top - GraphHeight);
+		for (float ms : {1000.0f / 60.0f, 1000.0f / 30.0f}) {
+			lines.draw(glm::vec3(graph_min.x, graph_min.y + ms * MsScale, 0.0f), glm::vec3(graph_min.x + Window, graph_min.y + ms * MsScale, 0.0f), gray);
+		}
+		for (uint32_t i = 0; i < count; ++i) {
+			uint64_t frame = state.frame - count + i;
+			float ms = state.frame_ms[frame % Window];
+			float x = graph_min.x + float(Window - count + i) + 0.5f;
+			lines.draw(glm::vec3(x, graph_min.y, 0.0f), glm::vec3(x, graph_min.y + std::min(ms, 50.0f) * MsScale, 0.0f), ms_color(ms));
+		}
+
+		//frame-time histogram, to the right of the graph:
+		std::array< uint32_t, HistogramBuckets > buckets{};
+		for (uint32_t i = 0; i < count; ++i) {
+			uint32_t b = uint32_t(state.frame_ms[i] / HistogramBucketMs);
+			buckets[std::min(b, HistogramBuckets - 1)] += 1;
+		}
+		uint32_t tallest = *std::max_element(buckets.begin(), buckets.end());
+		glm::vec2 hist_min(graph_min.x + Window + Margin, graph_min.y);
+		for (uint32_t b = 0; b < HistogramBuckets; ++b) {
+			float h = GraphHeight * float(buckets[b]) / float(std::max(1U, tallest));
+			float x0 = hist_min.x + b * 6.0f, x1 = x0 + 4.0f;
+			glm::u8vec4 color = ms_color((b + 0.5f) * HistogramBucketMs);
+			lines.draw(glm::vec3(x0, hist_min.y, 0.0f), glm::vec3(x0, hist_min.y + h, 0.0f), color);
+			lines.draw(glm::vec3(x0, hist_min.y + h, 0.0f), glm::vec3(x1, hist_min.y + h, 0.0f), color);
+			lines.draw(glm::vec3(x1, hist_min.y + h, 0.0f), glm::vec3(x1, hist_min.y, 0.0f), color);
+		}
+
+		//frame summary:
+		std::vector< float > sorted(state.frame_ms.begin(), state.frame_ms.begin() + count);
+		std::sort(sorted.begin(), sorted.end());
+		Summary frame_summary = summarize(state.frame_ms, count);
+		float p95 = sorted[std::min< size_t >(sorted.size() - 1, size_t(0.95f * float(sorted.size())))];
+		char buffer[256];
+		float y = graph_min.y - Margin - TextHeight;
+		std::snprintf(buffer, sizeof(buffer), "frame %.2fms avg  %.2fms p95  %.2fms max  (%.0f fps)", frame_summary.avg, p95, frame_summary.max, 1000.0f / std::max(0.001f, frame_summary.avg));
+		text(buffer, glm::vec2(Margin, y), white);
+		y -= TextHeight * 1.5f;
+
+		//per-scope table (avg / max over the window):
+		text("scope", glm::vec2(Margin, y), gray);
+		text("cpu avg", glm::vec2(Margin + 260.0f, y), gray);
+		text("cpu max", glm::vec2(Margin + 360.0f, y), gray);
+		text("gpu avg", glm::vec2(Margin + 460.0f, y), gray);
+		y -= TextHeight * 1.2f;
+		for (auto const &[name, stat] : state.stats) {
+			Summary cpu = summarize(stat.cpu_ms, count);
+			if (cpu.max == 0.0f && !stat.has_gpu) continue; //hasn't run recently
+			text(name, glm::vec2(Margin, y), white);
+			std::snprintf(buffer, sizeof(buffer), "%.3f", cpu.avg);
+			text(buffer, glm::vec2(Margin + 260.0f, y), white);
+			std::snprintf(buffer, sizeof(buffer), "%.3f", cpu.max);
+			text(buffer, glm::vec2(Margin + 360.0f, y), white);
+			if (stat.has_gpu) {
+				//the newest few frames don't have gpu results yet, so skip them:
+				constexpr uint32_t Lag = 4;
+				float sum = 0.0f;
+				uint32_t n = 0;
+				for (uint32_t i = 0; i + Lag < count; ++i) {
+					sum += stat.gpu_ms[(state.frame - count + i) % Window];
+					n += 1;
+				}
+				std::snprintf(buffer, sizeof(buffer), "%.3f", n ? sum / float(n) : 0.0f);
+				text(buffer, glm::vec2(Margin + 460.0f, y), white);
+			}
+			y -= TextHeight * 1.2f;
+		}
+
+		//counters (avg / max per frame over the window):
+		std::unique_lock< std::mutex > lock(state.mutex);
+		if (!state.counters.empty()) {
+			y -= TextHeight * 0.5f;
+			text("counter", glm::vec2(Margin, y), gray);
+			text("avg", glm::vec2(Margin + 260.0f, y), gray);
+			text("max", glm::vec2(Margin + 360.0f, y), gray);
+			y -= TextHeight * 1.2f;
+		}
+		for (auto const &[name, counter] : state.counters) {
+			Summary summary = summarize(counter.values, count);
+			text(name, glm::vec2(Margin, y), white);
+			std::snprintf(buffer, sizeof(buffer), "%.0f", summary.avg);
+			text(buffer, glm::vec2(Margin + 260.0f, y), white);
+			std::snprintf(buffer, sizeof(buffer), "%.0f", summary.max);
+			text(buffer, glm::vec2(Margin + 360.0f, y), white);
+			y -= TextHeight * 1.2f;
+		}
+	} //DrawLines draws when it goes out of scope
+	GLState::enable(GL_DEPTH_TEST);
+
+	GL_ERRORS();
+}
+
+//---------------- export ----------------
+
+void Profiler::export_csv(std::string const &filename) {
+	State &state = get_state();
+	std::ofstream out(filename, std::ios::binary);
+	if (!out) {
+		std::cerr << "WARNING: failed to open '" << filename << "' for profile export." << std::endl;
+		return;
+	}
+	out << "frame,thread,name,start_ms,cpu_ms,gpu_ms\n";
+	for (auto const &record : state.history) {
+		out << record.index << ",main,frame," << record.start / 1000.0 << "," << record.duration / 1000.0 << ",\n";
+		for (auto const &event : record.events) {
+			out << record.index << "," << event.thread << "," << event.name << "," << event.start / 1000.0 << "," << event.duration / 1000.0 << ",\n";
+		}
+		for (auto const &gpu : record.gpu) {
+			out << record.index << ",gpu," << gpu.name << "," << gpu.submitted / 1000.0 << ",," << gpu.ms << "\n";
+		}
+	}
+	std::cout << "Wrote " << state.history.size() << " frames of profile data to '" << filename << "'." << std::endl;
+}
+
+void Profiler::export_trace(std::string const &filename) {
+	State &state = get_state();
+	std::ofstream out(filename, std::ios::binary);
+	if (!out) {
+		std::cerr << "WARNING: failed to open '" << filename << "' for profile export." << std::endl;
+		return;
+	}
+
+	//GPU timings go on their own track; timer queries only give durations, so they are placed at their submit time:
+	constexpr uint32_t GPUTrack = 1000;
+
+	out << "{\"traceEvents\":[\n";
+	out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << GPUTrack << ",\"args\":{\"name\":\"GPU\"}}";
+	for (auto const &record : state.history) {
+		out << ",\n{\"name\":\"frame " << record.index << "\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":" << record.start << ",\"dur\":" << record.duration << "}";
+		for (auto const &event : record.events) {
+			out << ",\n{\"name\":\"" << json_escape(event.name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+		}
+		for (auto const &gpu : record.gpu) {
+			out << ",\n{\"name\":\"" << json_escape(gpu.name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << GPUTrack << ",\"ts\":" << gpu.submitted << ",\"dur\":" << uint64_t(gpu.ms * 1000.0) << "}";
+		}
+	}
+	out << "\n]}\n";
+	std::cout << "Wrote " << state.history.size() << " frames of trace events to '" << filename << "'." << std::endl;
+}
+
+void Profiler::shutdown() {
+	State &state = get_state();
+	for (auto const &pending : state.pending_queries) {
+		glDeleteQueries(1, &pending.query);
+	}
+	state.pending_queries.clear();
+	if (!state.free_queries.empty()) {
+		glDeleteQueries(GLsizei(state.free_queries.size()), state.free_queries.data());
+		state.free_queries.clear();
+	}
+}
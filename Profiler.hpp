@@ -0,0 +1,71 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <string>
+
+//Lightweight frame profiler.
+//
+//CPU timing: put PROFILE_SCOPE("Name") at the top of a block; the time until the end
+// of the block is recorded (from any thread; scopes may nest).
+//GPU timing: PROFILE_GPU_SCOPE("Name") wraps the GL commands issued in a block in a
+// GL_TIME_ELAPSED query (GL thread only). Timer queries can't nest, so a GPU scope
+// opened inside another GPU scope is ignored (its CPU time is still recorded).
+// Results are read back a few frames later, without stalling.
+//
+//Counters: PROFILE_COUNT("Name", amount) adds to a per-frame total (e.g., triangles drawn).
+// In a GL_PROFILE build, end_frame() also adds "glName calls" / "glName us" / "glName bytes"
+// counters for every GL entry point called during the frame.
+//
+//Names must be string literals (or otherwise outlive the profiler).
+//
+//The main loop calls Profiler::begin_frame() / end_frame() around each frame; per-name
+// totals are kept over a rolling window for the overlay, and the individual scopes of
+// recent frames are kept for export.
+
+namespace Profiler {
+
+struct CPUScope {
+	CPUScope(char const *name);
+	~CPUScope();
+	char const *name;
+	uint64_t start; //microseconds since profiler start
+};
+
+struct GPUScope {
+	GPUScope(char const *name);
+	~GPUScope();
+	uint32_t query = 0; //0 if this scope isn't being timed (nested inside another GPU scope)
+};
+
+//add 'amount' to this frame's total for a named counter (e.g., triangles drawn; any thread):
+// the overlay shows per-frame average / max over the window
+void count(char const *name, double amount);
+
+//frame boundaries (GL thread):
+void begin_frame();
+void end_frame();
+
+//draw rolling frame-time graph + per-scope table atop the current framebuffer:
+void draw_overlay(glm::uvec2 const &drawable_size);
+extern bool overlay_visible;
+
+//set false to skip GPU timer queries (e.g., in benchmarks, so queries don't add to what's being timed):
+extern bool gpu_scopes_enabled;
+
+//write every scope of the recorded frames (as 'frame,thread,name,start_ms,cpu_ms,gpu_ms' rows):
+void export_csv(std::string const &filename);
+//write the recorded frames as Chrome trace events (open with chrome://tracing or ui.perfetto.dev):
+void export_trace(std::string const &filename);
+
+//free GL objects (call before destroying the GL context):
+void shutdown();
+
+}
+
+#define PROFILE_CONCAT_(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_(A, B)
+#define PROFILE_SCOPE(NAME) Profiler::CPUScope PROFILE_CONCAT(profile_cpu_scope_, __LINE__)(NAME)
+#define PROFILE_GPU_SCOPE(NAME) Profiler::CPUScope PROFILE_CONCAT(profile_cpu_scope_, __LINE__)(NAME); Profiler::GPUScope PROFILE_CONCAT(profile_gpu_scope_, __LINE__)(NAME)
+#define PROFILE_COUNT(NAME, AMOUNT) Profiler::count(NAME, AMOUNT)
@@ -1,72 +1,107 @@
 #include "Rat.hpp"
-#include "PlayMode.hpp"
-#include "Player.hpp"
+#include "Profiler.hpp"
+#include "JobSystem.hpp"
+
 #include <algorithm>
 
-Rat::Rat(PlayMode *_game) : Character(_game)
+void RatSystem::add(Scene::Transform *transform)
 {
+    transforms.emplace_back(transform);
+    position_y.emplace_back(transform->position.y);
+    position_z.emplace_back(transform->position.z);
+    speed_y.emplace_back(0.0f);
+    speed_z.emplace_back(0.0f);
+    radius.emplace_back(transform->scale.y);
+    platform.emplace_back(nullptr);
+    aggro.emplace_back(0);
+    jumping.emplace_back(0);
 }
 
-void Rat::update(float elapsed)
+void RatSystem::set_solids(Character::Colliders lists)
 {
-    glm::vec3 playerPos = game->player->collision->position;
-    glm::vec3 ratPos = collision->position;
+    solids.build(lists);
+}
 
-    // Signed distance between the rat and the player
-    float deltaPos = playerPos.y - ratPos.y;
+void RatSystem::update(float elapsed, glm::vec3 const &player_position)
+{
+    PROFILE_SCOPE("RatSystem::update");
 
-    // Only move if in range
-    if (glm::distance(playerPos, ratPos) < aggroRange)
-    {
-        // Direction the rat should move in
-        float dir = copysign(1.0f, deltaPos);
+    // Rats don't interact with each other, so each chunk of rats is updated independently:
+    // (each rat only writes its own entries, so the result doesn't depend on thread count)
+    JobSystem::parallel_for(transforms.size(), 64, [&](size_t begin, size_t end) {
+        update_range(begin, end, elapsed, player_position);
+    });
+}
 
-        speed.y += dir * acceleration * elapsed;
-        speed.y = std::clamp(speed.y, -maxSpeed, maxSpeed);
+void RatSystem::update_range(size_t begin, size_t end, float elapsed, glm::vec3 const &player_position)
+{
+    float const player_y = player_position.y;
+    float const player_z = player_position.z;
 
-        // // Jump if close to player
-        // if (deltaPos < jumpRange && playerPos.z - ratPos.z > 2 * height) 
-        //     charJump(jumpHeight);
+    { // Aggro: squared distance to the player (characters live in the x = 0 plane), no branches:
+        float const range2 = aggroRange * aggroRange;
+        float const *__restrict py = position_y.data();
+        float const *__restrict pz = position_z.data();
+        uint8_t *__restrict ag = aggro.data();
+        for (size_t i = begin; i < end; ++i)
+        {
+            float dy = player_y - py[i];
+            float dz = player_z - pz[i];
+            ag[i] = uint8_t(dy * dy + dz * dz < range2);
+        }
+    }
 
-    } else {
-        // Slow down to a stop
-        speed.y -= speed.y * elapsed * 10;
+    { // Steering: accelerate toward the player if aggro'd, otherwise slow down to a stop:
+        float const *__restrict py = position_y.data();
+        float *__restrict sy = speed_y.data();
+        uint8_t const *__restrict ag = aggro.data();
+        for (size_t i = begin; i < end; ++i)
+        {
+            float dir = std::copysign(1.0f, player_y - py[i]);
+            float chase = std::clamp(sy[i] + dir * acceleration * elapsed, -maxSpeed, maxSpeed);
+            float stop = sy[i] - sy[i] * elapsed * 10.0f;
+            sy[i] = ag[i] ? chase : stop;
+        }
     }
 
-    applySpeed(elapsed);
+    // scratch space for grid queries (one per thread):
+    thread_local std::vector<Scene::Transform *> nearby;
 
-    // Resolve collisions with the player
-    if (!noclip)
+    // Movement + collision, against only the boxes near each rat:
+    for (size_t i = begin; i < end; ++i)
     {
-        platform = nullptr;
-
-        for (Scene::Transform *plate : game->collision_plates)
-		{
-			collide(plate, false);
-		}
-
-        for (Scene::Transform *grate : game->grates)
-		{
-			// Go throught the grate if melted enough
-			collide(grate, false);
-		}
-
-        for (Scene::Transform *bouncy : game->bouncy_weak_platforms)
-		{
-			collide(bouncy, false);
-		}
-
-		for (Scene::Transform *bouncy : game->bouncy_strong_platforms)
-		{
-			collide(bouncy, false);
-		}
-
-        for (Scene::Transform *plat : game->collision_platforms)
+        if (platform[i] == nullptr)
+            speed_z[i] -= gravity * elapsed;
+
+        glm::vec3 position = glm::vec3(0.0f, position_y[i], position_z[i]);
+        glm::vec3 speed = glm::vec3(0.0f, speed_y[i], speed_z[i]);
+        glm::vec3 displacement = speed * elapsed;
+
+        // everything the rat could touch while moving (padded for collide's contact slop):
+        glm::vec2 start = glm::vec2(position.y, position.z);
+        glm::vec2 stop = start + glm::vec2(displacement.y, displacement.z);
+        glm::vec2 pad = glm::vec2(radius[i] + 0.1f);
+        nearby.clear();
+        solids.query(glm::min(start, stop) - pad, glm::max(start, stop) + pad, &nearby);
+
+        Character::move(position, speed, radius[i], displacement, {&nearby});
+
+        Scene::Transform *on = nullptr;
+        bool is_jumping = jumping[i];
+        for (Scene::Transform *object : nearby)
         {
-            if (collide(plat, false))
-            {
-                jumping = false;
-            }
+            Character::resolve(position, speed, radius[i], object, false, &on, &is_jumping);
         }
+
+        position_y[i] = position.y;
+        position_z[i] = position.z;
+        speed_y[i] = speed.y;
+        speed_z[i] = speed.z;
+        platform[i] = on;
+        jumping[i] = is_jumping;
+
+        transforms[i]->position.x = 0.0f;
+        transforms[i]->position.y = position.y;
+        transforms[i]->position.z = position.z;
     }
-}
\ No newline at end of file
+}
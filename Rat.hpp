@@ -1,27 +1,53 @@
 #pragma once
 
 #include "Character.hpp"
+#include "CollisionGrid.hpp"
 
-struct Rat : public Character
-{
-    Rat(PlayMode *_game);
-
-    void update(float elapsed) override;
+#include <vector>
 
-    const float aggroRange = 40.0f;
-    const float jumpRange = 1.0f;
+// All of the level's rats, updated together.
+// Rat state is kept in flat per-field arrays (index i is rat i), so the aggro and
+// steering passes are simple loops over contiguous floats that the compiler can
+// vectorize, and collision only tests the boxes near each rat (via CollisionGrid).
+struct RatSystem
+{
+    // Tuning:
+    static constexpr float aggroRange = 40.0f;
+    static constexpr float jumpRange = 1.0f;
 
     // Jumping
-    const float height = 6.24f;
-    const float jumpHeight = height * 2.0f;
-    const float jumpAirTime = 0.8f;
-    const float gravity = (2 * jumpHeight) / (pow(jumpAirTime / 2.0f, 2.0f));
+    static constexpr float height = 6.24f;
+    static constexpr float jumpHeight = height * 2.0f;
+    static constexpr float jumpAirTime = 0.8f;
+    static constexpr float gravity = (2 * jumpHeight) / ((jumpAirTime / 2.0f) * (jumpAirTime / 2.0f));
 
     // Moving
-    // Acceleration and max speed of the player, accounting for the smaller parent node of the mesh
-    const float acceleration = 7.5f * 4.0f;
+    static constexpr float acceleration = 7.5f * 4.0f;
+    // Rats are slower than the cheese (which should travel 2x jump height in horizontal direction over a jump)
+    static constexpr float maxSpeed = ((jumpHeight * 2) / (jumpAirTime)) / 2.5f;
+
+    // Add a rat; its transform is both model and collision circle (radius is scale.y):
+    void add(Scene::Transform *transform);
+
+    // Build the lookup structure for the boxes rats collide with:
+    // (the boxes are assumed not to move afterward)
+    void set_solids(Character::Colliders lists);
+
+    // Chase the player (if in range), move, and resolve collisions (in parallel, via JobSystem):
+    void update(float elapsed, glm::vec3 const &player_position);
+    // ...the same for rats [begin,end):
+    void update_range(size_t begin, size_t end, float elapsed, glm::vec3 const &player_position);
+
+    size_t size() const { return transforms.size(); }
+
+    // Per-rat state:
+    std::vector<Scene::Transform *> transforms;
+    std::vector<float> position_y, position_z;
+    std::vector<float> speed_y, speed_z;
+    std::vector<float> radius;
+    std::vector<Scene::Transform *> platform; // box the rat is standing on (or nullptr)
+    std::vector<uint8_t> aggro; // 1 if chasing the player this update
+    std::vector<uint8_t> jumping;
 
-    // Player's maximum speed (want a nice arc, so should travel 2x jump height in horizontal direction)
-    // const float cheeseMaxSpeed = 10.0f * 2.0f;
-    const float maxSpeed = ((jumpHeight * 2) / (jumpAirTime)) / 2.5f ;
-};
\ No newline at end of file
+    CollisionGrid solids;
+};
@@ -2,8 +2,17 @@
 
 #include <string>
 #include <algorithm>
+#include <limits>
 #include <glm/gtc/type_ptr.hpp>
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define RAYCAST_SSE 1
+#endif
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
 // code adapted from https://medium.com/@logandvllrd/how-to-pick-a-3d-object-using-raycasting-in-c-39112aed1987
 Ray screen_point_to_world_ray(Scene::Camera* cam, glm::vec2 mouse_px, glm::uvec2 drawable_px)
 {
@@ -14,10 +23,10 @@ Ray screen_point_to_world_ray(Scene::Camera* cam, glm::vec2 mouse_px, glm::uvec2
 	glm::vec4 clip_near(x, y, -1.0f, 1.0f);
 	glm::vec4 clip_far(x, y, 1.0f, 1.0f);
 
-	glm::mat4 cam_l2w = glm::mat4(cam->transform->make_parent_from_local());
-	// glm::mat4 w2c = glm::inverse(cam_l2w);
-	glm::mat4 proj = cam->make_projection();
-	glm::mat4 inv_proj = glm::inverse(proj);
+	// (cached on the camera, so repeated casts in a frame don't re-invert the projection)
+	Scene::Camera::Matrices const &matrices = cam->matrices();
+	glm::mat4 cam_l2w = glm::mat4(matrices.world_from_camera);
+	glm::mat4 const &inv_proj = matrices.camera_from_clip;
 
 	// near point in eye space
 	glm::vec4 eye_near = inv_proj * clip_near;
@@ -60,7 +69,8 @@ void world_box(Scene::Transform* t, glm::vec3& center, glm::vec3& half)
 	glm::vec3 ay = glm::abs(Y);
 	glm::vec3 az = glm::abs(Z);
 
-	half = (ax + ay + az) * 0.5f;
+	// (the cube's half-size is 1, so each axis contributes its full length)
+	half = ax + ay + az;
 }
 
 bool ray_box_intersect(const Ray& r, const glm::vec3& c, const glm::vec3& h, float* t_out)
@@ -88,4 +98,347 @@ bool ray_box_intersect(const Ray& r, const glm::vec3& c, const glm::vec3& h, flo
 		return true;
 	}
 	return false;
-}
\ No newline at end of file
+}
+
+bool ray_obb_intersect(const Ray& r, const glm::mat4x3& local_from_world, const glm::vec3& min, const glm::vec3& max, float* t_out)
+{
+	// local = A * world + b is affine, so the local ray (A*o + b) + t*(A*d) reaches the same point at the same t:
+	Ray local;
+	local.origin = local_from_world * glm::vec4(r.origin, 1.0f);
+	local.dir = glm::mat3(local_from_world) * r.dir;
+	return ray_box_intersect(local, 0.5f * (min + max), 0.5f * (max - min), t_out);
+}
+
+RaySlab::RaySlab(const Ray& r) : origin(r.origin)
+{
+	// (same zero-direction handling as ray_box_intersect)
+	inv_dir = 1.0f / glm::vec3(
+		(r.dir.x != 0.0f ? r.dir.x : 1e-30f),
+		(r.dir.y != 0.0f ? r.dir.y : 1e-30f),
+		(r.dir.z != 0.0f ? r.dir.z : 1e-30f));
+}
+
+void RayBoxes4::set(uint32_t i, const glm::vec3& min, const glm::vec3& max)
+{
+	min_x[i] = min.x; min_y[i] = min.y; min_z[i] = min.z;
+	max_x[i] = max.x; max_y[i] = max.y; max_z[i] = max.z;
+}
+
+void RayBoxes8::set(uint32_t i, const glm::vec3& min, const glm::vec3& max)
+{
+	min_x[i] = min.x; min_y[i] = min.y; min_z[i] = min.z;
+	max_x[i] = max.x; max_y[i] = max.y; max_z[i] = max.z;
+}
+
+// scalar version of the batched test (used where SIMD isn't available):
+static uint32_t ray_boxes_scalar(const RaySlab& r, const float* min_x, const float* min_y, const float* min_z,
+	const float* max_x, const float* max_y, const float* max_z, uint32_t count, float t_max, float* t_out)
+{
+	uint32_t mask = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		glm::vec3 t0 = (glm::vec3(min_x[i], min_y[i], min_z[i]) - r.origin) * r.inv_dir;
+		glm::vec3 t1 = (glm::vec3(max_x[i], max_y[i], max_z[i]) - r.origin) * r.inv_dir;
+		glm::vec3 tmin3 = glm::min(t0, t1);
+		glm::vec3 tmax3 = glm::max(t0, t1);
+		float tmin = std::max(std::max(tmin3.x, tmin3.y), tmin3.z);
+		float tmax = std::min(std::min(tmax3.x, tmax3.y), tmax3.z);
+		t_out[i] = tmin;
+		if (tmax >= std::max(tmin, 0.0f) && tmin <= t_max) mask |= (1u << i);
+	}
+	return mask;
+}
+
+uint32_t ray_boxes4_intersect(const RaySlab& r, const RayBoxes4& b, float t_max, float t_out[4])
+{
+#ifdef RAYCAST_SSE
+	__m128 ox = _mm_set1_ps(r.origin.x), oy = _mm_set1_ps(r.origin.y), oz = _mm_set1_ps(r.origin.z);
+	__m128 ix = _mm_set1_ps(r.inv_dir.x), iy = _mm_set1_ps(r.inv_dir.y), iz = _mm_set1_ps(r.inv_dir.z);
+
+	__m128 t0x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b.min_x), ox), ix);
+	__m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b.max_x), ox), ix);
+	__m128 t0y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b.min_y), oy), iy);
+	__m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b.max_y), oy), iy);
+	__m128 t0z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b.min_z), oz), iz);
+	__m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b.max_z), oz), iz);
+
+	__m128 tmin = _mm_max_ps(_mm_max_ps(_mm_min_ps(t0x, t1x), _mm_min_ps(t0y, t1y)), _mm_min_ps(t0z, t1z));
+	__m128 tmax = _mm_min_ps(_mm_min_ps(_mm_max_ps(t0x, t1x), _mm_max_ps(t0y, t1y)), _mm_max_ps(t0z, t1z));
+	__m128 hit = _mm_and_ps(
+		_mm_cmpge_ps(tmax, _mm_max_ps(tmin, _mm_setzero_ps())),
+		_mm_cmple_ps(tmin, _mm_set1_ps(t_max)));
+
+	_mm_storeu_ps(t_out, tmin);
+	return uint32_t(_mm_movemask_ps(hit));
+#else
+	return ray_boxes_scalar(r, b.min_x, b.min_y, b.min_z, b.max_x, b.max_y, b.max_z, 4, t_max, t_out);
+#endif
+}
+
+uint32_t ray_boxes8_intersect(const RaySlab& r, const RayBoxes8& b, float t_max, float t_out[8])
+{
+#if defined(__AVX__)
+	__m256 ox = _mm256_set1_ps(r.origin.x), oy = _mm256_set1_ps(r.origin.y), oz = _mm256_set1_ps(r.origin.z);
+	__m256 ix = _mm256_set1_ps(r.inv_dir.x), iy = _mm256_set1_ps(r.inv_dir.y), iz = _mm256_set1_ps(r.inv_dir.z);
+
+	__m256 t0x = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(b.min_x), ox), ix);
+	__m256 t1x = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(b.max_x), ox), ix);
+	__m256 t0y = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(b.min_y), oy), iy);
+	__m256 t1y = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(b.max_y), oy), iy);
+	__m256 t0z = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(b.min_z), oz), iz);
+	__m256 t1z = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(b.max_z), oz), iz);
+
+	__m256 tmin = _mm256_max_ps(_mm256_max_ps(_mm256_min_ps(t0x, t1x), _mm256_min_ps(t0y, t1y)), _mm256_min_ps(t0z, t1z));
+	__m256 tmax = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(t0x, t1x), _mm256_max_ps(t0y, t1y)), _mm256_max_ps(t0z, t1z));
+	__m256 hit = _mm256_and_ps(
+		_mm256_cmp_ps(tmax, _mm256_max_ps(tmin, _mm256_setzero_ps()), _CMP_GE_OQ),
+		_mm256_cmp_ps(tmin, _mm256_set1_ps(t_max), _CMP_LE_OQ));
+
+	_mm256_storeu_ps(t_out, tmin);
+	return uint32_t(_mm256_movemask_ps(hit));
+#elif defined(RAYCAST_SSE)
+	RayBoxes4 lo, hi;
+	for (uint32_t i = 0; i < 4; ++i) {
+		lo.set(i, glm::vec3(b.min_x[i], b.min_y[i], b.min_z[i]), glm::vec3(b.max_x[i], b.max_y[i], b.max_z[i]));
+		hi.set(i, glm::vec3(b.min_x[i+4], b.min_y[i+4], b.min_z[i+4]), glm::vec3(b.max_x[i+4], b.max_y[i+4], b.max_z[i+4]));
+	}
+	return ray_boxes4_intersect(r, lo, t_max, t_out) | (ray_boxes4_intersect(r, hi, t_max, t_out + 4) << 4);
+#else
+	return ray_boxes_scalar(r, b.min_x, b.min_y, b.min_z, b.max_x, b.max_y, b.max_z, 8, t_max, t_out);
+#endif
+}
+
+//------------------------- RayBVH -------------------------
+
+void RayBVH::build(const std::vector<Scene::Transform*>& transforms, const Scene* scene)
+{
+	items = transforms;
+	nodes.clear();
+	parent.clear();
+	leaf_boxes.clear();
+	item_index.clear();
+
+	item_min.assign(items.size(), glm::vec3(-1.0f));
+	item_max.assign(items.size(), glm::vec3( 1.0f));
+	item_local_from_world.resize(items.size());
+	item_world_min.resize(items.size());
+	item_world_max.resize(items.size());
+	order.resize(items.size());
+	leaf_of.assign(items.size(), 0);
+	for (uint32_t i = 0; i < (uint32_t)items.size(); ++i) {
+		if (scene) {
+			if (Scene::Drawable* drawable = scene->drawable_for(items[i])) {
+				item_min[i] = drawable->min;
+				item_max[i] = drawable->max;
+			}
+		}
+		update_item(i);
+		order[i] = i;
+		item_index.emplace(items[i], i);
+	}
+	if (items.empty()) return;
+
+	nodes.reserve(2 * items.size());
+	parent.reserve(2 * items.size());
+
+	// top-down: split each node's items at the median center along its widest axis:
+	struct Todo { uint32_t node, begin, end; };
+	std::vector<Todo> todo;
+	nodes.emplace_back(Node{ glm::vec3(0.0f), glm::vec3(0.0f), 0, 0 });
+	parent.emplace_back(-1U);
+	todo.emplace_back(Todo{ 0, 0, (uint32_t)items.size() });
+	auto center = [&](uint32_t i) { return item_world_min[i] + item_world_max[i]; }; //(x2, which doesn't matter for comparisons)
+	while (!todo.empty()) {
+		Todo at = todo.back();
+		todo.pop_back();
+
+		if (at.end - at.begin <= LeafItems) {
+			nodes[at.node].first = at.begin;
+			nodes[at.node].count = at.end - at.begin;
+			for (uint32_t o = at.begin; o < at.end; ++o) leaf_of[order[o]] = at.node;
+			continue;
+		}
+
+		glm::vec3 min = center(order[at.begin]), max = min;
+		for (uint32_t o = at.begin; o < at.end; ++o) {
+			min = glm::min(min, center(order[o]));
+			max = glm::max(max, center(order[o]));
+		}
+		glm::vec3 span = max - min;
+		int axis = (span.x >= span.y && span.x >= span.z ? 0 : (span.y >= span.z ? 1 : 2));
+		uint32_t mid = (at.begin + at.end) / 2;
+		std::nth_element(order.begin() + at.begin, order.begin() + mid, order.begin() + at.end, [&](uint32_t a, uint32_t b) {
+			return center(a)[axis] < center(b)[axis];
+		});
+
+		uint32_t left = (uint32_t)nodes.size();
+		nodes[at.node].first = left;
+		nodes[at.node].count = 0;
+		nodes.emplace_back(Node{ glm::vec3(0.0f), glm::vec3(0.0f), 0, 0 });
+		nodes.emplace_back(Node{ glm::vec3(0.0f), glm::vec3(0.0f), 0, 0 });
+		parent.emplace_back(at.node);
+		parent.emplace_back(at.node);
+		todo.emplace_back(Todo{ left, at.begin, mid });
+		todo.emplace_back(Todo{ left + 1, mid, at.end });
+	}
+
+	leaf_boxes.resize(nodes.size());
+	refit();
+}
+
+void RayBVH::update_item(uint32_t i)
+{
+	glm::mat4x3 world_from_local = items[i]->make_world_from_local();
+	item_local_from_world[i] = items[i]->make_local_from_world();
+
+	// world bounds of the oriented box:
+	glm::vec3 center = world_from_local * glm::vec4(0.5f * (item_min[i] + item_max[i]), 1.0f);
+	glm::vec3 half = 0.5f * (item_max[i] - item_min[i]);
+	glm::mat3 A = glm::mat3(world_from_local);
+	glm::vec3 extent = glm::abs(A[0]) * half.x + glm::abs(A[1]) * half.y + glm::abs(A[2]) * half.z;
+	item_world_min[i] = center - extent;
+	item_world_max[i] = center + extent;
+}
+
+void RayBVH::update_leaf(uint32_t n)
+{
+	Node& node = nodes[n];
+	RayBoxes4& boxes = leaf_boxes[n];
+	node.min = item_world_min[order[node.first]];
+	node.max = item_world_max[order[node.first]];
+	for (uint32_t k = 0; k < LeafItems; ++k) {
+		// (unused slots repeat the first item; queries mask them off)
+		uint32_t i = order[node.first + (k < node.count ? k : 0)];
+		boxes.set(k, item_world_min[i], item_world_max[i]);
+		node.min = glm::min(node.min, item_world_min[i]);
+		node.max = glm::max(node.max, item_world_max[i]);
+	}
+}
+
+void RayBVH::refit()
+{
+	for (uint32_t i = 0; i < (uint32_t)items.size(); ++i) {
+		update_item(i);
+	}
+	// children come after parents, so a reverse sweep sees children first:
+	for (uint32_t n = (uint32_t)nodes.size(); n-- > 0; ) {
+		Node& node = nodes[n];
+		if (node.count) {
+			update_leaf(n);
+		} else {
+			node.min = glm::min(nodes[node.first].min, nodes[node.first + 1].min);
+			node.max = glm::max(nodes[node.first].max, nodes[node.first + 1].max);
+		}
+	}
+}
+
+void RayBVH::refit(Scene::Transform* moved)
+{
+	auto f = item_index.find(moved);
+	if (f == item_index.end()) return;
+	uint32_t i = f->second;
+	update_item(i);
+
+	uint32_t n = leaf_of[i];
+	update_leaf(n);
+	for (n = parent[n]; n != -1U; n = parent[n]) {
+		Node& node = nodes[n];
+		node.min = glm::min(nodes[node.first].min, nodes[node.first + 1].min);
+		node.max = glm::max(nodes[node.first].max, nodes[node.first + 1].max);
+	}
+}
+
+// slab test against a node's box; returns entry distance (or +inf on a miss / beyond t_max):
+static float ray_node_entry(const RaySlab& r, const RayBVH::Node& node, float t_max)
+{
+	glm::vec3 t0 = (node.min - r.origin) * r.inv_dir;
+	glm::vec3 t1 = (node.max - r.origin) * r.inv_dir;
+	glm::vec3 tmin3 = glm::min(t0, t1);
+	glm::vec3 tmax3 = glm::max(t0, t1);
+	float tmin = std::max(std::max(tmin3.x, tmin3.y), tmin3.z);
+	float tmax = std::min(std::min(tmax3.x, tmax3.y), tmax3.z);
+	if (tmax >= std::max(tmin, 0.0f) && tmin <= t_max) return tmin;
+	return std::numeric_limits<float>::infinity();
+}
+
+bool RayBVH::closest_hit(const Ray& r, RayHit* hit, float t_max) const
+{
+	if (nodes.empty()) return false;
+	RaySlab slab(r);
+
+	float best_t = t_max;
+	uint32_t best = -1U;
+
+	constexpr float Miss = std::numeric_limits<float>::infinity();
+	uint32_t stack[64];
+	uint32_t top = 0;
+	if (ray_node_entry(slab, nodes[0], best_t) == Miss) return false;
+	stack[top++] = 0;
+	while (top) {
+		uint32_t n = stack[--top];
+		const Node& node = nodes[n];
+		if (node.count) {
+			// world bounds first (four at once), then the exact box for whatever passes:
+			float entry[LeafItems];
+			uint32_t mask = ray_boxes4_intersect(slab, leaf_boxes[n], best_t, entry) & ((1u << node.count) - 1);
+			for (uint32_t k = 0; k < node.count; ++k) {
+				if (!(mask & (1u << k))) continue;
+				uint32_t i = order[node.first + k];
+				float tval;
+				if (ray_obb_intersect(r, item_local_from_world[i], item_min[i], item_max[i], &tval) && tval <= best_t) {
+					// (ties go to the earlier item, matching a linear scan in item order)
+					if (tval < best_t || i < best) {
+						best_t = tval;
+						best = i;
+					}
+				}
+			}
+			continue;
+		}
+		// push the farther child first, so the nearer one is visited first:
+		float tl = ray_node_entry(slab, nodes[node.first], best_t);
+		float tr = ray_node_entry(slab, nodes[node.first + 1], best_t);
+		if (tl > tr) {
+			if (tl != Miss) stack[top++] = node.first;
+			if (tr != Miss) stack[top++] = node.first + 1;
+		} else {
+			if (tr != Miss) stack[top++] = node.first + 1;
+			if (tl != Miss) stack[top++] = node.first;
+		}
+	}
+
+	if (best == -1U) return false;
+	if (hit) {
+		hit->transform = items[best];
+		hit->t = best_t;
+	}
+	return true;
+}
+
+bool RayBVH::any_hit(const Ray& r, float t_max) const
+{
+	if (nodes.empty()) return false;
+	RaySlab slab(r);
+
+	uint32_t stack[64];
+	uint32_t top = 0;
+	stack[top++] = 0;
+	while (top) {
+		uint32_t n = stack[--top];
+		const Node& node = nodes[n];
+		if (ray_node_entry(slab, node, t_max) == std::numeric_limits<float>::infinity()) continue;
+		if (node.count) {
+			float entry[LeafItems];
+			uint32_t mask = ray_boxes4_intersect(slab, leaf_boxes[n], t_max, entry) & ((1u << node.count) - 1);
+			for (uint32_t k = 0; k < node.count; ++k) {
+				if (!(mask & (1u << k))) continue;
+				uint32_t i = order[node.first + k];
+				float tval;
+				if (ray_obb_intersect(r, item_local_from_world[i], item_min[i], item_max[i], &tval) && tval <= t_max) return true;
+			}
+			continue;
+		}
+		stack[top++] = node.first + 1;
+		stack[top++] = node.first;
+	}
+	return false;
+}
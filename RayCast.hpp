@@ -1,5 +1,7 @@
 #pragma once
 #include <glm/glm.hpp>
+#include <limits>
+#include <unordered_map>
 #include <vector>
 
 #include "Scene.hpp"
@@ -10,5 +12,90 @@ struct Ray {
 };
 
 Ray screen_point_to_world_ray(Scene::Camera* cam, glm::vec2 mouse_px, glm::uvec2 drawable_px);
+// axis-aligned box around the [-1,1] cube (Scene::Drawable's default bounds) under t's parent_from_local transform:
 void world_box(Scene::Transform* t, glm::vec3& center, glm::vec3& half);
-bool ray_box_intersect(const Ray& r, const glm::vec3& c, const glm::vec3& h, float* t_out = nullptr);
\ No newline at end of file
+bool ray_box_intersect(const Ray& r, const glm::vec3& c, const glm::vec3& h, float* t_out = nullptr);
+
+// exact test against an oriented box: [min,max] in the space given by local_from_world
+// (e.g., a drawable's mesh bounds and its transform's make_local_from_world()).
+// The ray is moved into local space once, so t_out is still a world-space distance along r:
+bool ray_obb_intersect(const Ray& r, const glm::mat4x3& local_from_world, const glm::vec3& min, const glm::vec3& max, float* t_out = nullptr);
+
+// ray with its reciprocal direction precomputed, for testing many boxes:
+struct RaySlab {
+	RaySlab(const Ray& r);
+	glm::vec3 origin;
+	glm::vec3 inv_dir;
+};
+
+// axis-aligned boxes stored by component, so one SIMD slab test covers four (or eight) boxes:
+struct RayBoxes4 {
+	alignas(16) float min_x[4], min_y[4], min_z[4];
+	alignas(16) float max_x[4], max_y[4], max_z[4];
+	void set(uint32_t i, const glm::vec3& min, const glm::vec3& max);
+};
+struct RayBoxes8 {
+	alignas(32) float min_x[8], min_y[8], min_z[8];
+	alignas(32) float max_x[8], max_y[8], max_z[8];
+	void set(uint32_t i, const glm::vec3& min, const glm::vec3& max);
+};
+// returns a bitmask of the boxes hit with entry distance <= t_max, and writes every entry distance to t_out.
+// Hits and distances match ray_box_intersect. Unused slots still get tested, so mask them out of the result.
+// (SSE when available; the 8-wide version uses AVX only if compiled with it, otherwise two 4-wide tests)
+uint32_t ray_boxes4_intersect(const RaySlab& r, const RayBoxes4& boxes, float t_max, float t_out[4]);
+uint32_t ray_boxes8_intersect(const RaySlab& r, const RayBoxes8& boxes, float t_max, float t_out[8]);
+
+
+struct RayHit {
+	Scene::Transform* transform = nullptr;
+	float t = 0.0f; // distance along the ray (negative if the ray starts inside the box)
+};
+
+// Bounding volume hierarchy over the oriented bounding boxes of a set of transforms,
+// so ray queries only test the boxes near the ray instead of every candidate.
+//
+// Each transform's box is its drawable's object-space min/max (looked up in the scene
+// passed to build(); the [-1,1] cube if there is none), placed by make_world_from_local().
+// Nodes hold world-space axis-aligned bounds; leaves test their (up to) four items'
+// bounds at once with ray_boxes4_intersect, then each candidate exactly with ray_obb_intersect.
+//
+// The tree is built once; when objects move, refit() updates the boxes in place
+// (the tree shape is kept, so queries stay correct but may slow down if objects
+// move far from where they were at build time -- call build() again then).
+struct RayBVH {
+	void build(const std::vector<Scene::Transform*>& transforms, const Scene* scene = nullptr);
+
+	// recompute every box from the current transforms:
+	void refit();
+	// ...or just the box of one moved transform (and its ancestors):
+	void refit(Scene::Transform* moved);
+
+	// nearest box hit with t <= t_max (returns false if none):
+	bool closest_hit(const Ray& r, RayHit* hit, float t_max = std::numeric_limits<float>::max()) const;
+	// any box hit with t <= t_max (e.g., for line-of-sight checks; stops at the first hit found):
+	bool any_hit(const Ray& r, float t_max = std::numeric_limits<float>::max()) const;
+
+	bool empty() const { return items.empty(); }
+
+	static constexpr uint32_t LeafItems = 4;
+
+	struct Node {
+		glm::vec3 min, max;
+		uint32_t first; // leaf: first index into 'order'; interior: index of left child (right child is first+1)
+		uint32_t count; // leaf: number of items; interior: 0
+	};
+	std::vector<Node> nodes; // nodes[0] is the root; children always come after their parent
+	std::vector<uint32_t> parent; // parent of each node (-1U for the root)
+	std::vector<RayBoxes4> leaf_boxes; // world bounds of each leaf's items, in 'order' order (only used for leaves)
+
+	std::vector<Scene::Transform*> items;
+	std::vector<uint32_t> order; // item indices, grouped by leaf
+	std::vector<uint32_t> leaf_of; // leaf node of each item
+	std::vector<glm::vec3> item_min, item_max; // object-space bounds of each item
+	std::vector<glm::mat4x3> item_local_from_world;
+	std::vector<glm::vec3> item_world_min, item_world_max;
+	std::unordered_map<const Scene::Transform*, uint32_t> item_index;
+
+	void update_item(uint32_t i);
+	void update_leaf(uint32_t n);
+};
@@ -0,0 +1,181 @@
+#include "RenderThread.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+	struct State {
+		std::thread thread;
+		SDL_Window *window = nullptr;
+		SDL_GLContext context = nullptr;
+
+		std::mutex mutex;
+		std::condition_variable cv; //signalled when work is queued, finished, or the thread should stop
+		std::deque< std::function< void() > > queue;
+		bool busy = false; //render thread is running a task
+		bool stopping = false;
+		std::exception_ptr frame_error; //first exception thrown by a frame (rethrown on the main thread)
+
+		std::exception_ptr start_error; //set if the render thread couldn't make the context current
+		bool started = false;
+	};
+
+	State &get_state() {
+		static State state;
+		return state;
+	}
+
+	void render_main() {
+		State &state = get_state();
+		std::unique_lock< std::mutex > lock(state.mutex);
+
+		if (!SDL_GL_MakeCurrent(state.window, state.context)) {
+			state.start_error = std::make_exception_ptr(std::runtime_error("Render thread failed to make GL context current: " + std::string(SDL_GetError())));
+		}
+		state.started = true;
+		state.cv.notify_all();
+		if (state.start_error) return;
+
+		while (true) {
+			state.cv.wait(lock, [&](){ return state.stopping || !state.queue.empty(); });
+			if (state.queue.empty()) break; //(stopping, and everything queued is done)
+
+			std::function< void() > task = std::move(state.queue.front());
+			state.queue.pop_front();
+			state.busy = true;
+			lock.unlock();
+
+			try {
+				task();
+			} catch (...) {
+				std::lock_guard< std::mutex > error_lock(state.mutex);
+				if (!state.frame_error) state.frame_error = std::current_exception();
+			}
+			//destroy the task's captures here, since they may own GL objects (e.g., the last reference to a mode):
+			task = nullptr;
+
+			lock.lock();
+			state.busy = false;
+			state.cv.notify_all();
+		}
+
+		SDL_GL_MakeCurrent(state.window, nullptr);
+	}
+
+	//wait (with 'lock' held on the state's mutex) for the queue to empty and the render thread to go idle:
+	void wait_for_idle(std::unique_lock< std::mutex > &lock) {
+		State &state = get_state();
+		state.cv.wait(lock, [&](){ return state.queue.empty() && !state.busy; });
+	}
+
+	void rethrow_frame_error(std::unique_lock< std::mutex > &lock) {
+		State &state = get_state();
+		if (state.frame_error) {
+			std::exception_ptr error = state.frame_error;
+			state.frame_error = nullptr;
+			lock.unlock();
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+void RenderThread::start(SDL_Window *window, SDL_GLContext context) {
+	State &state = get_state();
+	if (state.thread.joinable()) throw std::runtime_error("RenderThread::start called twice.");
+
+	//a context can only be current on one thread at a time:
+	SDL_GL_MakeCurrent(window, nullptr);
+
+	state.window = window;
+	state.context = context;
+	state.stopping = false;
+	state.started = false;
+	state.start_error = nullptr;
+	state.thread = std::thread(render_main);
+
+	std::unique_lock< std::mutex > lock(state.mutex);
+	state.cv.wait(lock, [&](){ return state.started; });
+	if (state.start_error) {
+		lock.unlock();
+		state.thread.join();
+		SDL_GL_MakeCurrent(window, context);
+		std::rethrow_exception(state.start_error);
+	}
+}
+
+void RenderThread::stop() {
+	State &state = get_state();
+	if (!state.thread.joinable()) return;
+
+	{
+		std::unique_lock< std::mutex > lock(state.mutex);
+		wait_for_idle(lock);
+		state.stopping = true;
+		state.cv.notify_all();
+	}
+	state.thread.join();
+
+	SDL_GL_MakeCurrent(state.window, state.context);
+
+	std::unique_lock< std::mutex > lock(state.mutex);
+	rethrow_frame_error(lock);
+}
+
+bool RenderThread::running() {
+	return get_state().thread.joinable();
+}
+
+void RenderThread::submit_frame(std::function< void() > &&frame) {
+	State &state = get_state();
+	if (!running()) {
+		frame();
+		return;
+	}
+
+	std::unique_lock< std::mutex > lock(state.mutex);
+	wait_for_idle(lock);
+	rethrow_frame_error(lock);
+	state.queue.emplace_back(std::move(frame));
+	state.cv.notify_all();
+}
+
+void RenderThread::run_on_gl_thread(std::function< void() > const &fn) {
+	State &state = get_state();
+	if (!running()) {
+		fn();
+		return;
+	}
+
+	bool done = false;
+	std::exception_ptr error;
+
+	std::unique_lock< std::mutex > lock(state.mutex);
+	state.queue.emplace_back([&](){
+		try {
+			fn();
+		} catch (...) {
+			error = std::current_exception();
+		}
+		std::lock_guard< std::mutex > done_lock(state.mutex);
+		done = true;
+	});
+	state.cv.notify_all();
+	state.cv.wait(lock, [&](){ return done && !state.busy; });
+	lock.unlock();
+
+	if (error) std::rethrow_exception(error);
+}
+
+void RenderThread::wait_idle() {
+	State &state = get_state();
+	if (!running()) return;
+
+	std::unique_lock< std::mutex > lock(state.mutex);
+	wait_for_idle(lock);
+	rethrow_frame_error(lock);
+}
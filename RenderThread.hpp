@@ -0,0 +1,41 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <functional>
+
+//Optional render thread that owns the GL context, so that drawing frame N (and
+// waiting for it to be shown) overlaps the main thread's events and updates for frame N+1.
+//
+//The main loop hands each frame to the render thread as a function (see Mode::record).
+// Only one frame is ever in flight: submit_frame waits for the previous frame to finish,
+// so a mode can alternate between two buffers of recorded drawing.
+//
+//Anything else that makes GL calls while the render thread is running (creating or
+// destroying modes, resizing the viewport, ...) must go through run_on_gl_thread.
+//
+//If start() hasn't been called, everything runs immediately on the calling thread.
+
+namespace RenderThread {
+
+//release 'context' from the calling thread and make it current on a new render thread:
+// throws if the render thread can't make the context current
+void start(SDL_Window *window, SDL_GLContext context);
+
+//finish all queued work, stop the render thread, and make the context current on the calling thread again:
+void stop();
+
+bool running();
+
+//queue a frame, after waiting for the previous one to finish:
+// if a frame throws, the exception is rethrown by the next call to submit_frame, run_on_gl_thread, wait_idle, or stop
+void submit_frame(std::function< void() > &&frame);
+
+//run 'fn' on the render thread (after any queued frame) and wait for it to finish:
+// exceptions thrown by 'fn' are rethrown here
+void run_on_gl_thread(std::function< void() > const &fn);
+
+//wait for all queued work to finish:
+void wait_idle();
+
+}
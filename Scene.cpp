@@ -2,9 +2,15 @@
 
 #include "gl_errors.hpp"
 #include "read_write_chunk.hpp"
+#include "Profiler.hpp"
+#include "GLState.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 
 //-------------------------
@@ -77,61 +83,248 @@ glm::mat4 Scene::Camera::make_projection() const {
 	return glm::infinitePerspective( fovy, aspect, near );
 }
 
+Scene::Camera::Matrices const &Scene::Camera::matrices() const {
+	assert(transform);
+
+	//still valid?
+	bool valid = !cached_chain.empty() && cached_fovy == fovy && cached_aspect == aspect && cached_near == near;
+	if (valid) {
+		size_t i = 0;
+		for (Transform const *t = transform; t; t = t->parent, ++i) {
+			if (i >= cached_chain.size()) { valid = false; break; }
+			CachedTransform const &c = cached_chain[i];
+			if (c.transform != t || c.position != t->position || c.rotation != t->rotation || c.scale != t->scale) { valid = false; break; }
+		}
+		if (i != cached_chain.size()) valid = false;
+	}
+	if (valid) return cached;
+
+	cached_chain.clear();
+	for (Transform const *t = transform; t; t = t->parent) {
+		cached_chain.emplace_back(CachedTransform{ t, t->position, t->rotation, t->scale });
+	}
+	cached_fovy = fovy;
+	cached_aspect = aspect;
+	cached_near = near;
+
+	cached.clip_from_camera = make_projection();
+	cached.camera_from_clip = glm::inverse(cached.clip_from_camera);
+	cached.camera_from_world = transform->make_local_from_world();
+	cached.world_from_camera = transform->make_world_from_local();
+	cached.clip_from_world = cached.clip_from_camera * glm::mat4(cached.camera_from_world);
+	cached.world_from_clip = glm::mat4(cached.world_from_camera) * cached.camera_from_clip;
+	return cached;
+}
+
 //-------------------------
 
 
+//std140 lays out the columns of matN and matNx3 as vec4s:
+namespace {
+	struct CameraBlock {
+		glm::mat4 clip_from_world;
+		glm::vec4 light_from_world[4];
+		glm::vec4 light_from_world_normal[3];
+	};
+	static_assert(sizeof(CameraBlock) == 64 + 64 + 48, "CameraBlock matches the std140 layout of Camera.");
+
+	struct ObjectBlock {
+		glm::vec4 world_from_object[4];
+		glm::vec4 world_from_normal[3];
+	};
+	static_assert(sizeof(ObjectBlock) == 64 + 48, "ObjectBlock matches the std140 layout of Object.");
+
+	void std140_columns(glm::mat4x3 const &m, glm::vec4 *out) {
+		for (int c = 0; c < 4; ++c) {
+			out[c] = glm::vec4(m[c], 0.0f);
+		}
+	}
+	void std140_columns(glm::mat3 const &m, glm::vec4 *out) {
+		for (int c = 0; c < 3; ++c) {
+			out[c] = glm::vec4(m[c], 0.0f);
+		}
+	}
+
+	struct UniformBuffers {
+		UniformBuffers() {
+			glGenBuffers(1, &camera);
+			glGenBuffers(1, &objects);
+			GLint alignment = 1;
+			glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+			alignment = std::max(alignment, 1);
+			object_stride = (GLuint(sizeof(ObjectBlock)) + GLuint(alignment) - 1) / GLuint(alignment) * GLuint(alignment);
+		}
+		GLuint camera = 0;
+		GLuint objects = 0;
+		GLuint object_stride = 0; //sizeof(ObjectBlock), rounded up to the offset alignment
+		std::vector< uint8_t > object_data; //(kept between frames so it doesn't need to be reallocated)
+	};
+
+	//(created on first use, so the GL context exists)
+	UniformBuffers &get_uniform_buffers() {
+		static UniformBuffers buffers;
+		return buffers;
+	}
+}
+
+void Scene::bind_uniform_blocks(GLuint program) {
+	auto bind = [&](char const *name, GLuint binding) {
+		GLuint index = glGetUniformBlockIndex(program, name);
+		if (index != GL_INVALID_INDEX) glUniformBlockBinding(program, index, binding);
+	};
+	bind("Camera", CameraBinding);
+	bind("Lights", LightsBinding);
+	bind("Object", ObjectBinding);
+}
+
 void Scene::draw(Camera const &camera) const {
 	assert(camera.transform);
-	glm::mat4 clip_from_world = camera.make_projection() * glm::mat4(camera.transform->make_local_from_world());
+	glm::mat4 clip_from_world = camera.matrices().clip_from_world;
 	glm::mat4x3 light_from_world = glm::mat4x3(1.0f);
 	draw(clip_from_world, light_from_world);
 }
 
 void Scene::draw(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from_world) const {
+	//(kept between calls so items don't need to be reallocated every frame):
+	static DrawList list;
+	record(clip_from_world, light_from_world, &list);
+	draw(list);
+}
+
+void Scene::record(Camera const &camera, DrawList *list) const {
+	assert(camera.transform);
+	record(camera.matrices().clip_from_world, glm::mat4x3(1.0f), list);
+}
+
+void Scene::record(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from_world, DrawList *list_) const {
+	assert(list_);
+	DrawList &list = *list_;
+	list.clip_from_world = clip_from_world;
+	list.light_from_world = light_from_world;
+	list.items.clear();
+	list.stats = DrawStats();
+
+	//for LOD selection -- projected size (as a fraction of screen height) of a sphere at clip-space depth w is radius * y_scale / w:
+	float y_scale = glm::length(glm::vec3(clip_from_world[0][1], clip_from_world[1][1], clip_from_world[2][1]));
 
-	//Iterate through all drawables, sending each one to OpenGL:
 	for (auto const &drawable : drawables) {
-		//Reference to drawable's pipeline for convenience:
 		Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
 
-		//skip any drawables without a shader program set:
-		if (pipeline.program == 0) continue;
-		//skip any drawables that don't reference any vertex array:
-		if (pipeline.vao == 0) continue;
-		//skip any drawables that don't contain any vertices:
-		if (pipeline.count == 0) continue;
+		//skip any drawables without a shader program set, that don't reference any vertex array, or that don't contain any vertices:
+		if (pipeline.program == 0 || pipeline.vao == 0 || pipeline.count == 0) continue;
+
+		assert(drawable.transform); //drawables *must* have a transform
+		glm::mat4x3 world_from_object = drawable.transform->make_world_from_local();
+
+		//pick a level of detail:
+		GLuint start = pipeline.start;
+		GLuint count = pipeline.count;
+		if (!drawable.lods.empty()) {
+			glm::vec3 center = world_from_object * glm::vec4(0.5f * (drawable.min + drawable.max), 1.0f);
+			float scale = std::max(glm::length(world_from_object[0]), std::max(glm::length(world_from_object[1]), glm::length(world_from_object[2])));
+			float radius = 0.5f * glm::length(drawable.max - drawable.min) * scale;
+			float w = (clip_from_world * glm::vec4(center, 1.0f)).w;
+			float size = (w > radius ? radius * y_scale / w : lod_full_detail_size);
+			if (size < lod_full_detail_size) {
+				//each level down covers half the size of the one before:
+				float level = std::ceil(std::log2(lod_full_detail_size / std::max(size, 1e-6f)));
+				Drawable::LOD const &lod = drawable.lods[std::min(size_t(level), drawable.lods.size()) - 1];
+				start = lod.start;
+				count = lod.count;
+			}
+		}
+		list.stats.drawables += 1;
+		if (pipeline.type == GL_TRIANGLES) {
+			list.stats.triangles += count / 3;
+			list.stats.triangles_saved += (pipeline.count - count) / 3;
+		}
+
+		list.items.emplace_back(DrawList::Item{pipeline, world_from_object, start, count});
+	}
+
+	draw_stats = list.stats;
+}
+
+void Scene::draw(DrawList const &list) {
+	PROFILE_GPU_SCOPE("Scene::draw");
+
+	glm::mat4 const &clip_from_world = list.clip_from_world;
+	glm::mat4x3 const &light_from_world = list.light_from_world;
+
+	UniformBuffers &buffers = get_uniform_buffers();
+
+	{ //per-frame data, shared by every program with a Camera block:
+		CameraBlock block;
+		block.clip_from_world = clip_from_world;
+		std140_columns(light_from_world, block.light_from_world);
+		std140_columns(glm::inverse(glm::transpose(glm::mat3(light_from_world))), block.light_from_world_normal);
+		GLState::bind_buffer(GL_UNIFORM_BUFFER, buffers.camera);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(block), &block, GL_STREAM_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, CameraBinding, buffers.camera);
+	}
+
+	{ //Object blocks for all items that use them, uploaded together:
+		buffers.object_data.clear();
+		for (auto const &item : list.items) {
+			if (!item.pipeline.object_block) continue;
+			ObjectBlock block;
+			std140_columns(item.world_from_object, block.world_from_object);
+			std140_columns(glm::inverse(glm::transpose(glm::mat3(item.world_from_object))), block.world_from_normal);
+
+			size_t offset = buffers.object_data.size();
+			buffers.object_data.resize(offset + buffers.object_stride);
+			std::memcpy(buffers.object_data.data() + offset, &block, sizeof(block));
+		}
+		if (!buffers.object_data.empty()) {
+			GLState::bind_buffer(GL_UNIFORM_BUFFER, buffers.objects);
+			//orphan the old storage so the GPU can keep reading last frame's blocks while we write these:
+			glBufferData(GL_UNIFORM_BUFFER, buffers.object_data.size(), nullptr, GL_STREAM_DRAW);
+			glBufferSubData(GL_UNIFORM_BUFFER, 0, buffers.object_data.size(), buffers.object_data.data());
+		}
+		GLState::bind_buffer(GL_UNIFORM_BUFFER, 0);
+	}
+	GLintptr object_offset = 0;
 
+	//Iterate through all items, sending each one to OpenGL:
+	for (auto const &item : list.items) {
+		//Reference to item's pipeline for convenience:
+		Scene::Drawable::Pipeline const &pipeline = item.pipeline;
 
 		//Set shader program:
-		glUseProgram(pipeline.program);
+		GLState::use_program(pipeline.program);
 
 		//Set attribute sources:
-		glBindVertexArray(pipeline.vao);
+		GLState::bind_vertex_array(pipeline.vao);
 
 		//Configure program uniforms:
 
-		//the object-to-world matrix is used in all three of these uniforms:
-		assert(drawable.transform); //drawables *must* have a transform
-		glm::mat4x3 world_from_object = drawable.transform->make_world_from_local();
+		if (pipeline.object_block) {
+			//this item's transforms were written above, in the same order:
+			glBindBufferRange(GL_UNIFORM_BUFFER, ObjectBinding, buffers.objects, object_offset, sizeof(ObjectBlock));
+			object_offset += buffers.object_stride;
+		} else {
+			//the object-to-world matrix is used in all three of these uniforms:
+			glm::mat4x3 const &world_from_object = item.world_from_object;
 
-		//CLIP_FROM_OBJECT takes vertices from object space to clip space:
-		if (pipeline.CLIP_FROM_OBJECT_mat4 != -1U) {
-			glm::mat4 clip_from_object = clip_from_world * glm::mat4(world_from_object);
-			glUniformMatrix4fv(pipeline.CLIP_FROM_OBJECT_mat4, 1, GL_FALSE, glm::value_ptr(clip_from_object));
-		}
+			//CLIP_FROM_OBJECT takes vertices from object space to clip space:
+			if (pipeline.CLIP_FROM_OBJECT_mat4 != -1U) {
+				glm::mat4 clip_from_object = clip_from_world * glm::mat4(world_from_object);
+				glUniformMatrix4fv(pipeline.CLIP_FROM_OBJECT_mat4, 1, GL_FALSE, glm::value_ptr(clip_from_object));
+			}
 
-		//the object-to-light matrix is used in the next two uniforms:
-		glm::mat4x3 light_from_object = light_from_world * glm::mat4(world_from_object);
+			//the object-to-light matrix is used in the next two uniforms:
+			glm::mat4x3 light_from_object = light_from_world * glm::mat4(world_from_object);
 
-		//CLIP_FROM_OBJECT takes vertices from object space to light space:
-		if (pipeline.LIGHT_FROM_OBJECT_mat4x3 != -1U) {
-			glUniformMatrix4x3fv(pipeline.LIGHT_FROM_OBJECT_mat4x3, 1, GL_FALSE, glm::value_ptr(light_from_object));
-		}
+			//CLIP_FROM_OBJECT takes vertices from object space to light space:
+			if (pipeline.LIGHT_FROM_OBJECT_mat4x3 != -1U) {
+				glUniformMatrix4x3fv(pipeline.LIGHT_FROM_OBJECT_mat4x3, 1, GL_FALSE, glm::value_ptr(light_from_object));
+			}
 
-		//LIGHT_FROM_NORMAL takes normals from object space to light space:
-		if (pipeline.LIGHT_FROM_NORMAL_mat3 != -1U) {
-			glm::mat3 light_from_normal = glm::inverse(glm::transpose(glm::mat3(light_from_object)));
-			glUniformMatrix3fv(pipeline.LIGHT_FROM_NORMAL_mat3, 1, GL_FALSE, glm::value_ptr(light_from_normal));
+			//LIGHT_FROM_NORMAL takes normals from object space to light space:
+			if (pipeline.LIGHT_FROM_NORMAL_mat3 != -1U) {
+				glm::mat3 light_from_normal = glm::inverse(glm::transpose(glm::mat3(light_from_object)));
+				glUniformMatrix3fv(pipeline.LIGHT_FROM_NORMAL_mat3, 1, GL_FALSE, glm::value_ptr(light_from_normal));
+			}
 		}
 
 		//set any requested custom uniforms:
@@ -140,27 +333,19 @@ void Scene::draw(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from
 		//set up textures:
 		for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
 			if (pipeline.textures[i].texture != 0) {
-				glActiveTexture(GL_TEXTURE0 + i);
-				glBindTexture(pipeline.textures[i].target, pipeline.textures[i].texture);
+				GLState::active_texture(GL_TEXTURE0 + i);
+				GLState::bind_texture(pipeline.textures[i].target, pipeline.textures[i].texture);
 			}
 		}
 
-		//draw the object:
-		glDrawArrays(pipeline.type, pipeline.start, pipeline.count);
-
-		//un-bind textures:
-		for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
-			if (pipeline.textures[i].texture != 0) {
-				glActiveTexture(GL_TEXTURE0 + i);
-				glBindTexture(pipeline.textures[i].target, 0);
-			}
-		}
-		glActiveTexture(GL_TEXTURE0);
+		//draw the object (at the level of detail chosen by record()):
+		glDrawArrays(pipeline.type, item.start, item.count);
 
+		//(program, vertex array, and textures stay bound -- GLState skips re-binding them if the next item shares them)
 	}
 
-	glUseProgram(0);
-	glBindVertexArray(0);
+	PROFILE_COUNT("triangles drawn", list.stats.triangles);
+	PROFILE_COUNT("triangles saved by LOD", list.stats.triangles_saved);
 
 	GL_ERRORS();
 }
@@ -304,6 +489,8 @@ void Scene::load(std::string const &filename,
 	//load any extra that a subclass wants:
 	load_extra(file, names, hierarchy_transforms);
 
+	build_index();
+
 	if (file.peek() != EOF) {
 		std::cerr << "WARNING: trailing data in scene file '" << filename << "'" << std::endl;
 	}
@@ -374,4 +561,39 @@ void Scene::set(Scene const &other, std::unordered_map< Transform const *, Trans
 	for (auto &l : lights) {
 		l.transform = transform_to_transform.at(l.transform);
 	}
+
+	build_index();
+}
+
+//-------------------------
+
+std::string Scene::tag_of(std::string const &name) {
+	size_t end = 0;
+	while (end < name.size() && std::isalpha(static_cast< unsigned char >(name[end]))) ++end;
+	return name.substr(0, end);
+}
+
+std::vector< Scene::Transform * > const &Scene::tagged(std::string const &tag) const {
+	static std::vector< Transform * > const none;
+	auto f = tag_index.find(tag);
+	if (f == tag_index.end()) return none;
+	return f->second;
+}
+
+Scene::Drawable *Scene::drawable_for(Transform const *transform) const {
+	auto f = drawable_index.find(transform);
+	if (f == drawable_index.end()) return nullptr;
+	return f->second;
+}
+
+void Scene::build_index() {
+	tag_index.clear();
+	for (auto &t : transforms) {
+		tag_index[tag_of(t.name)].emplace_back(&t);
+	}
+
+	drawable_index.clear();
+	for (auto &d : drawables) {
+		drawable_index.emplace(d.transform, &d); //(emplace keeps the first drawable for each transform)
+	}
 }
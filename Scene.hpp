@@ -54,6 +54,12 @@ struct Scene {
 		Drawable(Transform *transform_) : transform(transform_) { assert(transform); }
 		Transform * transform;
 
+		//Object-space bounding box of what's drawn (e.g., Mesh::min/max); used for picking and LOD selection:
+		// (default is the [-1,1] cube that scaled-cube meshes occupy -- 2 units across, not 1; picking code
+		//  without a drawable to ask, like world_box and RayBVH items with no drawable, assumes the same box)
+		glm::vec3 min = glm::vec3(-1.0f);
+		glm::vec3 max = glm::vec3( 1.0f);
+
 		//Contains all the data needed to run the OpenGL pipeline:
 		struct Pipeline {
 			GLuint program = 0; //shader program; passed to glUseProgram
@@ -69,6 +75,8 @@ struct Scene {
 			GLuint CLIP_FROM_OBJECT_mat4 = -1U; //uniform location for object to clip space matrix
 			GLuint LIGHT_FROM_OBJECT_mat4x3 = -1U; //uniform location for object to light space (== world space) matrix
 			GLuint LIGHT_FROM_NORMAL_mat3 = -1U; //uniform location for normal to light space (== world space) matrix
+			//...or, if set, the program reads its object transforms from the "Object" uniform block (see Scene::ObjectBinding) instead:
+			bool object_block = false;
 
 			std::function< void() > set_uniforms; //(optional) function to set any other useful uniforms
 
@@ -79,6 +87,16 @@ struct Scene {
 				GLenum target = GL_TEXTURE_2D;
 			} textures[TextureCount];
 		} pipeline;
+
+		//(optional) simpler versions of the mesh -- vertex ranges in pipeline.vao, coarsest last:
+		// draw() uses lods[i-1] in place of pipeline.start/count once the drawable's bounding sphere
+		// covers less than lod_full_detail_size / 2^(i-1) of the screen height (see Mesh::lods)
+		// (these index pipeline.vao, so code that replaces pipeline.vao/start/count must also clear lods)
+		struct LOD {
+			GLuint start = 0;
+			GLuint count = 0;
+		};
+		std::vector< LOD > lods;
 	};
 
 	struct Camera {
@@ -93,6 +111,29 @@ struct Scene {
 		float near = 0.01f; //near plane
 		//computed from the above:
 		glm::mat4 make_projection() const;
+
+		//projection and view matrices (and their inverses), cached:
+		// recomputed on the next call after fovy, aspect, near, or the camera's transform (or any parent) changes
+		struct Matrices {
+			glm::mat4 clip_from_camera; //== make_projection()
+			glm::mat4 camera_from_clip;
+			glm::mat4x3 camera_from_world; //== transform->make_local_from_world()
+			glm::mat4x3 world_from_camera;
+			glm::mat4 clip_from_world;
+			glm::mat4 world_from_clip;
+		};
+		Matrices const &matrices() const;
+
+		//cache state for matrices():
+		struct CachedTransform {
+			Transform const *transform;
+			glm::vec3 position;
+			glm::quat rotation;
+			glm::vec3 scale;
+		};
+		mutable std::vector< CachedTransform > cached_chain; //camera's transform, then its parents (empty if never computed)
+		mutable float cached_fovy = 0.0f, cached_aspect = 0.0f, cached_near = 0.0f;
+		mutable Matrices cached;
 	};
 
 	struct Light {
@@ -122,12 +163,66 @@ struct Scene {
 	std::list< Camera > cameras;
 	std::list< Light > lights;
 
+	//Lookup by name tag, built by load() and set():
+	// a transform's tag is the leading run of letters in its name (e.g., "Rat_3" and "Rat_original" have tag "Rat")
+	static std::string tag_of(std::string const &name);
+	// ...transforms with a given tag, in scene order (empty if none):
+	std::vector< Transform * > const &tagged(std::string const &tag) const;
+	// ...first drawable attached to a transform (nullptr if none):
+	Drawable *drawable_for(Transform const *transform) const;
+	//call after adding or removing transforms/drawables by hand to bring the above up to date:
+	void build_index();
+
+	std::unordered_map< std::string, std::vector< Transform * > > tag_index;
+	std::unordered_map< Transform const *, Drawable * > drawable_index;
+
+	//Uniform blocks (std140) that draw() fills, for programs that declare them:
+	// "Camera" (binding CameraBinding) -- per-frame:
+	//    mat4 CLIP_FROM_WORLD; mat4x3 LIGHT_FROM_WORLD; mat3 LIGHT_FROM_WORLD_NORMAL;
+	// "Object" (binding ObjectBinding) -- per-drawable, for pipelines with object_block set:
+	//    mat4x3 WORLD_FROM_OBJECT; mat3 WORLD_FROM_NORMAL;
+	// every drawable's Object block is written to one buffer at the start of draw(), so each draw just binds its range.
+	// (binding LightsBinding is used by LightClusters)
+	enum : GLuint { CameraBinding = 0, LightsBinding = 1, ObjectBinding = 2 };
+	//point a program's "Camera", "Lights", and "Object" blocks (whichever it has) at the bindings above:
+	static void bind_uniform_blocks(GLuint program);
+
+	//LOD selection: drawables covering at least this fraction of the screen height are drawn at full detail:
+	float lod_full_detail_size = 0.25f;
+
+	//what the most recent draw() (or record()) drew (also reported as "triangles drawn"/"triangles saved by LOD" profiler counters):
+	struct DrawStats {
+		uint32_t drawables = 0;
+		uint32_t triangles = 0; //(counting GL_TRIANGLES pipelines only)
+		uint32_t triangles_saved = 0; //by drawing a LOD instead of full detail
+	};
+	mutable DrawStats draw_stats;
+
 	//The "draw" function provides a convenient way to pass all the things in a scene to OpenGL:
 	void draw(Camera const &camera) const;
 
 	//..sometimes, you want to draw with a custom projection matrix and/or light space:
 	void draw(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from_world = glm::mat4x3(1.0f)) const;
 
+	//draw() is record() then draw(list); the halves can also be called separately -- e.g., to record
+	// on the main thread and draw on a render thread while the scene goes on changing:
+	struct DrawList {
+		glm::mat4 clip_from_world = glm::mat4(1.0f);
+		glm::mat4x3 light_from_world = glm::mat4x3(1.0f);
+		struct Item {
+			Drawable::Pipeline pipeline; //(a copy, so game code can change the drawable's pipeline meanwhile; set_uniforms still runs at draw time)
+			glm::mat4x3 world_from_object;
+			GLuint start, count; //vertex range, after LOD selection
+		};
+		std::vector< Item > items;
+		DrawStats stats;
+	};
+	//fill 'list' with the drawables to draw (skipping empty ones), their world matrices, and their LODs; doesn't touch GL:
+	void record(Camera const &camera, DrawList *list) const;
+	void record(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from_world, DrawList *list) const;
+	//send a recorded list to OpenGL:
+	static void draw(DrawList const &list);
+
 	//add transforms/objects/cameras from a scene file to this scene:
 	// the 'on_drawable' callback gives your code a chance to look up mesh data and make Drawables:
 	// throws on file format errors
@@ -0,0 +1,266 @@
+#include "ScreenCapture.hpp"
+
+#include "load_save_png.hpp"
+#include "gl_errors.hpp"
+#include "GLState.hpp"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//---------------- internal state ----------------
+
+namespace {
+	//number of frames that can be in flight between glReadPixels and mapping:
+	// (three frames is enough for the GPU to finish a readback before its buffer is reused)
+	constexpr uint32_t RingSize = 3;
+
+	//frames waiting for the encoders beyond this make capture() wait (keeps memory bounded while recording):
+	constexpr size_t MaxQueuedFrames = 64;
+
+	struct Readback {
+		GLuint buffer = 0;
+		GLsizeiptr buffer_bytes = 0;
+		GLsync fence = 0;
+		glm::uvec2 size = glm::uvec2(0);
+		std::vector< std::string > filenames; //empty when not in flight
+	};
+
+	struct Frame {
+		glm::uvec2 size = glm::uvec2(0);
+		std::vector< glm::u8vec4 > data;
+		std::vector< std::string > filenames;
+	};
+
+	struct Capturer {
+		//encoder threads:
+		std::mutex mutex;
+		std::condition_variable work_cv; //signalled when work is added or stopping is set
+		std::condition_variable done_cv; //signalled when a frame is taken off the queue
+		std::deque< Frame > work;
+		std::vector< std::thread > encoders;
+		bool stopping = false;
+
+		//readback ring (only touched on the GL thread):
+		std::array< Readback, RingSize > ring;
+		uint32_t next = 0; //oldest (and next to be reused) ring slot
+
+		std::string screenshot_filename; //non-empty if a screenshot has been requested
+		bool recording = false;
+		std::string record_prefix;
+		uint32_t record_frame = 0;
+	};
+
+	Capturer &get_capturer() {
+		static Capturer capturer;
+		return capturer;
+	}
+
+	void encoder_main() {
+		Capturer &capturer = get_capturer();
+		while (true) {
+			Frame frame;
+			{
+				std::unique_lock< std::mutex > lock(capturer.mutex);
+				capturer.work_cv.wait(lock, [&](){ return capturer.stopping || !capturer.work.empty(); });
+				if (capturer.work.empty()) return; //stopping, and everything has been written
+				frame = std::move(capturer.work.front());
+				capturer.work.pop_front();
+			}
+			capturer.done_cv.notify_all();
+
+			//the default framebuffer's alpha isn't meaningful:
+			for (auto &px : frame.data) {
+				px.a = 0xff;
+			}
+			for (auto const &filename : frame.filenames) {
+				try {
+					save_png(filename, frame.size, frame.data.data(), LowerLeftOrigin);
+				} catch (std::exception &e) {
+					std::cerr << "WARNING: failed to save '" << filename << "': " << e.what() << std::endl;
+				}
+			}
+		}
+	}
+
+	//map a finished readback and hand it to the encoders;
+	// if 'wait' is false, returns false (without doing anything) if the GPU hasn't finished yet:
+	bool finish(Readback &readback, bool wait) {
+		if (readback.filenames.empty()) return true;
+
+		while (true) {
+			GLenum result = glClientWaitSync(readback.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? 1000000000ULL : 0);
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) break;
+			if (result == GL_WAIT_FAILED) {
+				std::cerr << "WARNING: waiting for screen capture readback failed; frame lost." << std::endl;
+				glDeleteSync(readback.fence);
+				readback.fence = 0;
+				readback.filenames.clear();
+				return true;
+			}
+			if (!wait) return false;
+		}
+		glDeleteSync(readback.fence);
+		readback.fence = 0;
+
+		Frame frame;
+		frame.size = readback.size;
+		frame.data.resize(readback.size.x * readback.size.y);
+		frame.filenames = std::move(readback.filenames);
+		readback.filenames.clear();
+
+		GLsizeiptr bytes = GLsizeiptr(frame.data.size() * sizeof(glm::u8vec4));
+		GLState::bind_buffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+		void *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT);
+		if (mapped) {
+			std::memcpy(frame.data.data(), mapped, size_t(bytes));
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		GLState::bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+		GL_ERRORS();
+		if (!mapped) {
+			std::cerr << "WARNING: failed to map screen capture readback; frame lost." << std::endl;
+			return true;
+		}
+
+		Capturer &capturer = get_capturer();
+		{
+			std::unique_lock< std::mutex > lock(capturer.mutex);
+			capturer.done_cv.wait(lock, [&](){ return capturer.work.size() < MaxQueuedFrames; });
+			capturer.work.emplace_back(std::move(frame));
+		}
+		capturer.work_cv.notify_one();
+
+		return true;
+	}
+}
+
+//---------------- ScreenCapture ----------------
+
+void ScreenCapture::init(uint32_t threads) {
+	Capturer &capturer = get_capturer();
+	assert(capturer.encoders.empty() && "ScreenCapture::init should only be called once");
+
+	if (threads == 0) {
+		//PNG encoding is much slower than readback, so recording wants a few encoders:
+		threads = std::clamp(std::thread::hardware_concurrency(), 2U, 8U) / 2U;
+	}
+	capturer.stopping = false;
+	for (uint32_t i = 0; i < threads; ++i) {
+		capturer.encoders.emplace_back(encoder_main);
+	}
+}
+
+void ScreenCapture::shutdown() {
+	Capturer &capturer = get_capturer();
+
+	//collect anything still in flight (oldest first):
+	for (uint32_t i = 0; i < RingSize; ++i) {
+		finish(capturer.ring[(capturer.next + i) % RingSize], true);
+	}
+	for (auto &readback : capturer.ring) {
+		if (readback.buffer) {
+			GLState::delete_buffers(1, &readback.buffer);
+			readback.buffer = 0;
+			readback.buffer_bytes = 0;
+		}
+	}
+	capturer.recording = false;
+	capturer.screenshot_filename.clear();
+
+	//let the encoders drain the queue and exit:
+	{
+		std::unique_lock< std::mutex > lock(capturer.mutex);
+		capturer.stopping = true;
+	}
+	capturer.work_cv.notify_all();
+	for (auto &encoder : capturer.encoders) {
+		encoder.join();
+	}
+	capturer.encoders.clear();
+}
+
+void ScreenCapture::request_screenshot(std::string const &filename) {
+	get_capturer().screenshot_filename = filename;
+}
+
+void ScreenCapture::start_recording(std::string const &prefix) {
+	Capturer &capturer = get_capturer();
+	std::filesystem::path parent = std::filesystem::path(prefix).parent_path();
+	if (!parent.empty()) {
+		std::error_code ec;
+		std::filesystem::create_directories(parent, ec);
+		if (ec) std::cerr << "WARNING: couldn't create '" << parent.string() << "' for recording: " << ec.message() << std::endl;
+	}
+	capturer.recording = true;
+	capturer.record_prefix = prefix;
+}
+
+void ScreenCapture::stop_recording() {
+	get_capturer().recording = false;
+}
+
+bool ScreenCapture::recording() {
+	return get_capturer().recording;
+}
+
+void ScreenCapture::capture(glm::uvec2 const &drawable_size) {
+	Capturer &capturer = get_capturer();
+
+	//hand off readbacks the GPU has already finished (fences signal in order, so stop at the first unfinished one):
+	for (uint32_t i = 0; i < RingSize; ++i) {
+		if (!finish(capturer.ring[(capturer.next + i) % RingSize], false)) break;
+	}
+
+	//nothing to read back (e.g., while minimized) -- leave any screenshot request pending and don't use up a frame number:
+	if (drawable_size.x == 0 || drawable_size.y == 0) return;
+
+	std::vector< std::string > filenames;
+	if (!capturer.screenshot_filename.empty()) {
+		filenames.emplace_back(capturer.screenshot_filename);
+		std::cout << "Saving screenshot to '" << capturer.screenshot_filename << "'." << std::endl;
+		capturer.screenshot_filename.clear();
+	}
+	if (capturer.recording) {
+		std::ostringstream name;
+		name << capturer.record_prefix << std::setw(6) << std::setfill('0') << capturer.record_frame << ".png";
+		filenames.emplace_back(name.str());
+		capturer.record_frame += 1;
+	}
+	if (filenames.empty()) return;
+
+	//reuse the oldest slot; if it is still in flight, wait for it rather than dropping a frame:
+	Readback &readback = capturer.ring[capturer.next];
+	finish(readback, true);
+	capturer.next = (capturer.next + 1) % RingSize;
+
+	GLsizeiptr bytes = GLsizeiptr(drawable_size.x) * GLsizeiptr(drawable_size.y) * GLsizeiptr(sizeof(glm::u8vec4));
+	if (readback.buffer == 0) glGenBuffers(1, &readback.buffer);
+	GLState::bind_buffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+	if (readback.buffer_bytes != bytes) {
+		glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+		readback.buffer_bytes = bytes;
+	}
+
+	//read from the back buffer (the frame just drawn) into the pack buffer -- returns without waiting for the GPU:
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glReadBuffer(GL_BACK);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, drawable_size.x, drawable_size.y, GL_RGBA, GL_UNSIGNED_BYTE, (GLbyte *)0);
+	GLState::bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	readback.size = drawable_size;
+	readback.filenames = std::move(filenames);
+
+	GL_ERRORS();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <string>
+
+//Non-blocking screenshots and frame dumps.
+// Frames are read back into a ring of pixel-pack buffers (so glReadPixels returns
+// immediately), fenced, and only mapped once the GPU has finished writing them;
+// PNG encoding happens on background threads.
+//
+//Usage (main loop):
+//  ScreenCapture::init();
+//  ...after drawing a frame, before swapping:
+//  ScreenCapture::capture(drawable_size);
+//  ...at exit (before destroying the GL context):
+//  ScreenCapture::shutdown();
+
+namespace ScreenCapture {
+
+//start PNG encoding threads (0 = choose based on hardware concurrency):
+void init(uint32_t threads = 0);
+
+//finish any in-flight captures, wait for all queued PNGs to be written, and free GL objects:
+void shutdown();
+
+//save the next captured frame to 'filename':
+void request_screenshot(std::string const &filename);
+
+//start/stop saving every frame as '<prefix>NNNNNN.png':
+// (frames are never dropped -- if readback falls behind, capture() waits for the GPU)
+void start_recording(std::string const &prefix);
+void stop_recording();
+bool recording();
+
+//read back the current back buffer if a screenshot was requested or recording is active,
+// and hand any finished readbacks to the encoder threads; call after drawing, before swapping:
+void capture(glm::uvec2 const &drawable_size);
+
+}
@@ -2,6 +2,7 @@
 
 #include "ShowMeshesProgram.hpp"
 #include "DrawLines.hpp"
+#include "GLState.hpp"
 
 #include <iostream>
 
@@ -119,14 +120,14 @@ void ShowMeshesMode::draw(glm::uvec2 const &drawable_size) {
 	//--- actual drawing ---
 	glClearColor(0.5f, 0.5f, 0.5f, 0.0f);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	glDisable(GL_BLEND);
-	glEnable(GL_DEPTH_TEST);
+	GLState::disable(GL_BLEND);
+	GLState::enable(GL_DEPTH_TEST);
 	glDepthFunc(GL_LEQUAL);
 
 	scene.draw(*scene_camera);
 
 	{ //decorate with some lines:
-		DrawLines draw_lines(scene_camera->make_projection() * glm::mat4(scene_camera->transform->make_local_from_world()));
+		DrawLines draw_lines(scene_camera->matrices().clip_from_world);
 
 		//axis (unit-length):
 		draw_lines.draw(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::u8vec4(0xff, 0x00, 0x00, 0xff));
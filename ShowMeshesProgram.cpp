@@ -2,6 +2,7 @@
 
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
+#include "GLState.hpp"
 
 Scene::Drawable::Pipeline show_meshes_program_pipeline;
 
@@ -70,7 +71,8 @@ ShowMeshesProgram::ShowMeshesProgram() {
 		"		vec3 l = vec3(0.0,0.0,1.0);\n"
 		"		fragColor = vec4(mix(vec3(0.5), vec3(1.0), 0.5 * dot(n,l) + 0.5) * color.rgb, color.a);\n"
 		"	}\n"
-		"}\n"
+		"}\n",
+		"show_meshes"
 	);
 
 	//look up the locations of vertex attributes:
@@ -88,7 +90,7 @@ ShowMeshesProgram::ShowMeshesProgram() {
 }
 
 ShowMeshesProgram::~ShowMeshesProgram() {
-	glDeleteProgram(program);
+	GLState::delete_program(program);
 	program = 0;
 }
 
@@ -1,5 +1,6 @@
 #include "ShowSceneMode.hpp"
 #include "DrawLines.hpp"
+#include "GLState.hpp"
 
 #include <iostream>
 
@@ -87,14 +88,14 @@ void ShowSceneMode::draw(glm::uvec2 const &drawable_size) {
 	//--- actual drawing ---
 	glClearColor(0.5f, 0.5f, 0.5f, 0.0f);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	glDisable(GL_BLEND);
-	glEnable(GL_DEPTH_TEST);
+	GLState::disable(GL_BLEND);
+	GLState::enable(GL_DEPTH_TEST);
 	glDepthFunc(GL_LEQUAL);
 
 	scene.draw(*scene_camera);
 
 	{ //decorate with some lines:
-		DrawLines draw_lines(scene_camera->make_projection() * glm::mat4(scene_camera->transform->make_local_from_world()));
+		DrawLines draw_lines(scene_camera->matrices().clip_from_world);
 		for (auto &transform : scene.transforms) {
 			glm::mat4 world_from_local = transform.make_world_from_local();
 			auto xf = [&world_from_local](glm::vec3 const &vec) {
@@ -130,7 +131,7 @@ void ShowSceneMode::draw(glm::uvec2 const &drawable_size) {
 		}
 		/*
 		glEnable(GL_LINE_SMOOTH);
-		glEnable(GL_BLEND);
+		GLState::enable(GL_BLEND);
 		glBlendEquation(GL_FUNC_ADD);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 		*/
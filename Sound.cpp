@@ -1,6 +1,7 @@
 #include "Sound.hpp"
 #include "load_wav.hpp"
 #include "load_opus.hpp"
+#include "Profiler.hpp"
 
 #include <SDL3/SDL.h>
 
@@ -83,6 +84,8 @@ void Sound::shutdown() {
 
 
 void Sound::lock() {
+	//time spent here is time the game waited on the audio thread:
+	PROFILE_SCOPE("Sound::lock");
 	if (stream) SDL_LockAudioStream(stream);
 }
 
@@ -0,0 +1,140 @@
+#include "StaticBatch.hpp"
+
+#include "gl_errors.hpp"
+#include "GLState.hpp"
+
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+StaticBatches::~StaticBatches() {
+	for (auto &batch : batches) {
+		GLState::delete_vertex_arrays(1, &batch.vao);
+		batch.vao = 0;
+	}
+}
+
+void StaticBatches::build(Scene *scene_, MeshBuffer const &source, GLuint source_vao, std::unordered_set< Scene::Transform const * > const &dynamic) {
+	Scene &scene = *scene_;
+	if (!batches.empty()) throw std::runtime_error("StaticBatches::build called twice.");
+
+	if (source.Position.stride != sizeof(DynamicMeshBuffer::Vertex)) {
+		throw std::runtime_error("StaticBatches::build needs a mesh buffer with DynamicMeshBuffer::Vertex layout.");
+	}
+
+	//drawables sharing these can be drawn together:
+	auto same_material = [](Scene::Drawable::Pipeline const &a, Scene::Drawable::Pipeline const &b) {
+		if (a.program != b.program || a.type != b.type || a.object_block != b.object_block) return false;
+		for (uint32_t i = 0; i < Scene::Drawable::Pipeline::TextureCount; ++i) {
+			if (a.textures[i].texture != b.textures[i].texture || a.textures[i].target != b.textures[i].target) return false;
+		}
+		return true;
+	};
+
+	struct Pending {
+		Scene::Drawable::Pipeline pipeline; //(of the first drawable)
+		std::vector< DynamicMeshBuffer::Vertex > vertices;
+		glm::vec3 min = glm::vec3( std::numeric_limits< float >::infinity());
+		glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+		uint32_t merged = 0;
+	};
+	std::vector< Pending > pending;
+
+	//read back the source vertices once (as needed):
+	std::vector< DynamicMeshBuffer::Vertex > source_vertices;
+	auto read_source = [&]() {
+		if (!source_vertices.empty()) return;
+		GLint size = 0;
+		GLState::bind_buffer(GL_ARRAY_BUFFER, source.buffer);
+		glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+		source_vertices.resize(size_t(size) / sizeof(DynamicMeshBuffer::Vertex));
+		glGetBufferSubData(GL_ARRAY_BUFFER, 0, source_vertices.size() * sizeof(DynamicMeshBuffer::Vertex), source_vertices.data());
+		GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
+	};
+
+	for (auto d = scene.drawables.begin(); d != scene.drawables.end(); ) {
+		Scene::Drawable const &drawable = *d;
+		Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
+		bool batchable = pipeline.vao == source_vao
+			&& pipeline.program != 0
+			&& pipeline.count != 0
+			&& pipeline.type == GL_TRIANGLES
+			&& !pipeline.set_uniforms
+			&& drawable.lods.empty()
+			&& drawable.transform->parent == nullptr
+			&& !dynamic.count(drawable.transform);
+		if (!batchable) {
+			++d;
+			continue;
+		}
+
+		read_source();
+		if (size_t(pipeline.start) + pipeline.count > source_vertices.size()) {
+			throw std::runtime_error("StaticBatches::build: drawable '" + drawable.transform->name + "' is out of range of its mesh buffer.");
+		}
+
+		Pending *into = nullptr;
+		for (auto &p : pending) {
+			if (same_material(p.pipeline, pipeline)) {
+				into = &p;
+				break;
+			}
+		}
+		if (!into) {
+			pending.emplace_back();
+			into = &pending.back();
+			into->pipeline = pipeline;
+		}
+
+		//move vertices to world space:
+		glm::mat4x3 world_from_local = drawable.transform->make_world_from_local();
+		glm::mat3 world_from_normal = glm::inverse(glm::transpose(glm::mat3(world_from_local)));
+		into->vertices.reserve(into->vertices.size() + pipeline.count);
+		for (GLuint v = pipeline.start; v < pipeline.start + pipeline.count; ++v) {
+			DynamicMeshBuffer::Vertex vertex = source_vertices[v];
+			vertex.Position = world_from_local * glm::vec4(vertex.Position, 1.0f);
+			vertex.Normal = glm::normalize(world_from_normal * vertex.Normal);
+			into->min = glm::min(into->min, vertex.Position);
+			into->max = glm::max(into->max, vertex.Position);
+			into->vertices.emplace_back(vertex);
+		}
+		into->merged += 1;
+
+		d = scene.drawables.erase(d);
+	}
+
+	if (pending.empty()) return;
+
+	scene.transforms.emplace_back();
+	transform = &scene.transforms.back();
+	transform->name = "StaticBatch";
+
+	uint32_t merged = 0;
+	size_t vertex_count = 0;
+	for (auto const &p : pending) {
+		batches.emplace_back();
+		Batch &batch = batches.back();
+		batch.vertices.set(p.vertices, GL_STATIC_DRAW);
+		batch.vao = batch.vertices.make_vao_for_program(p.pipeline.program);
+		batch.merged = p.merged;
+
+		scene.drawables.emplace_back(transform);
+		batch.drawable = &scene.drawables.back();
+		batch.drawable->pipeline = p.pipeline;
+		batch.drawable->pipeline.vao = batch.vao;
+		batch.drawable->pipeline.start = 0;
+		batch.drawable->pipeline.count = GLuint(p.vertices.size());
+		batch.drawable->min = p.min;
+		batch.drawable->max = p.max;
+
+		merged += p.merged;
+		vertex_count += p.vertices.size();
+	}
+
+	scene.build_index();
+
+	std::cout << "Static batching: merged " << merged << " drawables (" << vertex_count << " vertices) into " << batches.size() << " batch" << (batches.size() == 1 ? "" : "es") << "." << std::endl;
+
+	GL_ERRORS();
+}
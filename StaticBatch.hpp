@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Scene.hpp"
+#include "Mesh.hpp"
+#include "DynamicMeshBuffer.hpp"
+
+#include <list>
+#include <unordered_set>
+
+//Static batching: drawables that never move are merged, at load time, into buffers of
+// world-space vertices -- one per program + texture set + primitive type -- and each
+// batch is drawn with a single call (as one drawable on an identity transform).
+//The merged drawables are removed from the scene, but their transforms stay, so
+// gameplay lookups (tags, collision boxes, ray casts) work as before.
+struct StaticBatches {
+	StaticBatches() = default;
+	~StaticBatches();
+	StaticBatches(StaticBatches const &) = delete;
+	StaticBatches &operator=(StaticBatches const &) = delete;
+
+	//merge every drawable in 'scene' that:
+	//  - draws vertices from 'source' through 'source_vao' (so they can be read back)
+	//  - has no parent and isn't in 'dynamic' (transforms the game moves, re-tints, or re-meshes)
+	//  - has no set_uniforms callback (so it doesn't need its own uniforms)
+	//  - has no LOD chain (so Scene::draw can still pick its level of detail)
+	// 'source' must use the DynamicMeshBuffer::Vertex layout (i.e., be a .pnct file).
+	// (call once, after the game has found the transforms it needs; rebuilds scene's index)
+	void build(Scene *scene, MeshBuffer const &source, GLuint source_vao, std::unordered_set< Scene::Transform const * > const &dynamic);
+
+	struct Batch {
+		DynamicMeshBuffer vertices; //world-space
+		GLuint vao = 0;
+		Scene::Drawable *drawable = nullptr;
+		uint32_t merged = 0; //number of drawables merged into this batch
+	};
+	std::list< Batch > batches; //(list because DynamicMeshBuffer can't be copied)
+
+	Scene::Transform *transform = nullptr; //identity transform shared by the batch drawables
+};
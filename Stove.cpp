@@ -1,5 +1,6 @@
 #include "Stove.hpp"
 #include "LitColorTextureProgram.hpp"
+#include "GLState.hpp"
 
 #include <glm/gtc/quaternion.hpp>
 #include <algorithm>
@@ -9,7 +10,7 @@
 StoveSystem::StoveSystem() {}
 StoveSystem::~StoveSystem() {
     for (auto& tex : tint_lvl_) {
-        if (tex) { glDeleteTextures(1, &tex); tex = 0; }
+        if (tex) { GLState::delete_textures(1, &tex); tex = 0; }
     }
 }
 
@@ -17,14 +18,14 @@ StoveSystem::~StoveSystem() {
 GLuint StoveSystem::make_solid_tex(glm::u8vec4 rgba) {
     GLuint tex = 0;
     glGenTextures(1, &tex);
-    glBindTexture(GL_TEXTURE_2D, tex);
+    GLState::bind_texture(GL_TEXTURE_2D, tex);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &rgba);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    GLState::bind_texture(GL_TEXTURE_2D, 0);
     return tex;
 }
 
@@ -32,24 +33,24 @@ void StoveSystem::init(Scene& scene) {
     scene_ = &scene;
     knobs_.clear();
     plates_.clear();
-
-    // collect transforms by name prefix:
-    for (auto& t : scene.transforms) {
-        if (t.name.size() >= 6 && t.name.rfind("Switch", 0) == 0) {
-            knobs_.push_back(Knob{ &t, 0, -1 });
-        }
-        else if (t.name.size() >= 5 && t.name.rfind("Plate", 0) == 0) {
-            plates_.push_back(Plate{ &t, nullptr, 0 });
-        }
+    knob_index_.clear();
+    plate_index_.clear();
+    hot_plates_.clear();
+
+    // collect transforms by name tag, and each plate's drawable:
+    for (auto* t : scene.tagged("Switch")) {
+        knob_index_.emplace(t, (int)knobs_.size());
+        knobs_.push_back(Knob{ t, 0, -1 });
     }
-
-    // match each Plate transform to its drawable :
-    for (auto& d : scene.drawables) {
-        for (auto& p : plates_) {
-            if (d.transform == p.t) { p.d = &d; break; }
-        }
+    for (auto* t : scene.tagged("Plate")) {
+        plate_index_.emplace(t, (int)plates_.size());
+        plates_.push_back(Plate{ t, scene.drawable_for(t), 0 });
     }
 
+    std::vector<Scene::Transform*> knob_transforms;
+    for (auto& k : knobs_) knob_transforms.push_back(k.t);
+    knob_bvh_.build(knob_transforms, &scene);
+
     // pair each knob to the nearest plate
     for (auto& k : knobs_) {
         k.plate_index = find_nearest_plate_index(k.t);
@@ -64,7 +65,6 @@ void StoveSystem::init(Scene& scene) {
     // all plates appear level 0 by default
     for (int i = 0; i < (int)plates_.size(); ++i) {
         apply_plate_tint_for_level(i, 0);
-        plates_[i].level = 0;
     }
 
     /*std::cout << "[StoveSystem] (names-only) "
@@ -72,11 +72,9 @@ void StoveSystem::init(Scene& scene) {
 }
 
 int StoveSystem::get_level_for_plate(Scene::Transform* plate_t) const {
-    if (!plate_t) return 0;
-    for (const auto& p : plates_) {
-        if (p.t == plate_t) return std::clamp(p.level, 0, 3);
-    }
-    return 0; // default to 0
+    auto f = plate_index_.find(plate_t);
+    if (f == plate_index_.end()) return 0; // default to 0
+    return plates_[f->second].level;
 }
 
 int StoveSystem::find_nearest_plate_index(Scene::Transform* from) const {
@@ -96,12 +94,14 @@ int StoveSystem::find_nearest_plate_index(Scene::Transform* from) const {
 }
 
 int* StoveSystem::find_knob_state(Scene::Transform* t) {
-    for (auto& k : knobs_) if (k.t == t) return &k.state;
-    return nullptr;
+    auto f = knob_index_.find(t);
+    if (f == knob_index_.end()) return nullptr;
+    return &knobs_[f->second].state;
 }
 
 void StoveSystem::rotate_knob(Scene::Transform* t) {
     t->rotation = t->rotation * glm::angleAxis(glm::radians(90.0f), glm::vec3(0, 0, 1));
+    knob_bvh_.refit(t);
 }
 
 void StoveSystem::apply_plate_tint_for_level(int plate_index, int level) {
@@ -113,16 +113,25 @@ void StoveSystem::apply_plate_tint_for_level(int plate_index, int level) {
     p.d->pipeline.textures[0].texture = tint_lvl_[L];
     p.d->pipeline.textures[0].target = GL_TEXTURE_2D;
     p.level = L;
+
+    // keep hot_plates_ in step (swap-remove, so both directions are O(1)):
+    if (L > 0 && p.hot_slot < 0) {
+        p.hot_slot = (int)hot_plates_.size();
+        hot_plates_.push_back(p.t);
+    }
+    else if (L == 0 && p.hot_slot >= 0) {
+        Scene::Transform* moved = hot_plates_.back();
+        hot_plates_[p.hot_slot] = moved;
+        plates_[plate_index_.at(moved)].hot_slot = p.hot_slot;
+        hot_plates_.pop_back();
+        p.hot_slot = -1;
+    }
 }
 
 void StoveSystem::set_level_for_plate(Scene::Transform* plate_t, int level) {
-    if (!plate_t) return;
-    for (int i = 0; i < (int)plates_.size(); ++i) {
-        if (plates_[i].t == plate_t) {
-            apply_plate_tint_for_level(i, level);
-            return;
-        }
-    }
+    auto f = plate_index_.find(plate_t);
+    if (f == plate_index_.end()) return;
+    apply_plate_tint_for_level(f->second, level);
 }
 
 void StoveSystem::set_level(int level) {
@@ -133,40 +142,22 @@ void StoveSystem::set_level(int level) {
 bool StoveSystem::try_toggle(const Ray& ray, int* out_level) {
     if (!scene_) return false;
 
-    // Find nearest Switch* AABB hit
-    Scene::Transform* best_switch = nullptr;
-    float best_t = std::numeric_limits<float>::max();
-
-    for (auto& k : knobs_) {
-        glm::vec3 c, h;
-        world_box(k.t, c, h);
-        float tval;
-        if (ray_box_intersect(ray, c, h, &tval) && tval < best_t) {
-            best_t = tval;
-            best_switch = k.t;
-        }
-    }
-    if (!best_switch) return false;
-
-    // change knob state
-    rotate_knob(best_switch);
-    int* state = find_knob_state(best_switch);
-    if (!state) return false;
-    *state = (*state + 1) % 4;
-
-    // find the knob object to get its paired plate
-    for (auto& k : knobs_) {
-        if (k.t == best_switch) {
-            if (k.plate_index >= 0) {
-                apply_plate_tint_for_level(k.plate_index, *state);
-            }
-            break;
-        }
+    // Find nearest Switch* box hit
+    RayHit hit;
+    if (!knob_bvh_.closest_hit(ray, &hit)) return false;
+    int best = knob_index_.at(hit.transform);
+
+    // change knob state, and its paired plate's level
+    Knob& k = knobs_[best];
+    rotate_knob(k.t);
+    k.state = (k.state + 1) % 4;
+    if (k.plate_index >= 0) {
+        apply_plate_tint_for_level(k.plate_index, k.state);
     }
 
-    if (out_level) *out_level = *state;
+    if (out_level) *out_level = k.state;
 
-    //std::cout << "[StoveSystem] Toggled " << best_switch->name
-    //    << " -> level " << *state << " (paired plate updated)\n";
+    //std::cout << "[StoveSystem] Toggled " << k.t->name
+    //    << " -> level " << k.state << " (paired plate updated)\n";
     return true;
 }
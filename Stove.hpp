@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <glm/glm.hpp>
 
 #include "Scene.hpp"
@@ -22,6 +23,9 @@ public:
 
     int get_level_for_plate(Scene::Transform* plate_t) const;
 
+    // plates currently above level 0 (kept up to date as knobs turn; order is arbitrary):
+    const std::vector<Scene::Transform*>& hot_plates() const { return hot_plates_; }
+
 
 private:
     struct Knob {
@@ -33,6 +37,7 @@ private:
         Scene::Transform* t = nullptr;
         Scene::Drawable* d = nullptr; // drawable that references t
         int level = 0;                 // remember its own level
+        int hot_slot = -1;             // index in hot_plates_ (or -1 if level 0)
     };
 
     int* find_knob_state(Scene::Transform* t);
@@ -50,6 +55,15 @@ private:
     std::vector<Knob>  knobs_;
     std::vector<Plate> plates_;
 
+    // transform -> index in knobs_ / plates_:
+    std::unordered_map<const Scene::Transform*, int> knob_index_;
+    std::unordered_map<const Scene::Transform*, int> plate_index_;
+
+    std::vector<Scene::Transform*> hot_plates_;
+
+    // knob boxes, for picking:
+    RayBVH knob_bvh_;
+
     // 1x1 tint textures:
     GLuint tint_lvl_[4] = { 0,0,0,0 };
 };
@@ -6,6 +6,8 @@
 #include <algorithm>
 
 #include "gl_compile_program.hpp"
+#include "Profiler.hpp"
+#include "GLState.hpp"
 
 // Shaders taken from https://github.com/jialand/TheMuteLift#
 const GLchar *vertexSrc =
@@ -64,20 +66,20 @@ TextManager::TextManager()
     hb_ft_font_set_funcs(hb_font); // use FT-provided metric functions
 
     // Taken from https://github.com/jialand/TheMuteLift#
-    program = gl_compile_program(vertexSrc, fragmentSrc);
+    program = gl_compile_program(vertexSrc, fragmentSrc, "text");
     Position = glGetUniformLocation(program, "uScreen");
     Colour = glGetUniformLocation(program, "uColor");
     TexCoord = glGetUniformLocation(program, "uTex");
 
     glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
+    GLState::bind_vertex_array(vao);
     glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    GLState::bind_buffer(GL_ARRAY_BUFFER, vbo);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4, (void *)0);
     glEnableVertexAttribArray(1);
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4, (void *)(sizeof(float) * 2));
-    glBindVertexArray(0);
+    GLState::bind_vertex_array(0);
 }
 
 TextManager::~TextManager()
@@ -85,14 +87,14 @@ TextManager::~TextManager()
     for (auto &ch : character_atlas)
     {
         if (ch.second.tex_id)
-            glDeleteTextures(1, &ch.second.tex_id);
+            GLState::delete_textures(1, &ch.second.tex_id);
     }
     hb_font_destroy(hb_font);
     FT_Done_Face(ft_face);
     FT_Done_FreeType(ft_library);
-    glDeleteBuffers(1, &vbo);
-    glDeleteVertexArrays(1, &vao);
-    glDeleteProgram(program);
+    GLState::delete_buffers(1, &vbo);
+    GLState::delete_vertex_arrays(1, &vao);
+    GLState::delete_program(program);
 }
 
 void TextManager::load_glyph(hb_codepoint_t gid)
@@ -113,7 +115,7 @@ void TextManager::load_glyph(hb_codepoint_t gid)
 
     // Texture loading taken from https://github.com/jialand/TheMuteLift#
     glGenTextures(1, &g.tex_id);
-    glBindTexture(GL_TEXTURE_2D, g.tex_id);
+    GLState::bind_texture(GL_TEXTURE_2D, g.tex_id);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, g.width, g.height, 0, GL_RED, GL_UNSIGNED_BYTE, bitmap.buffer);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -126,9 +128,10 @@ void TextManager::load_glyph(hb_codepoint_t gid)
 
 void TextManager::draw_text(std::string str, glm::vec2 window_dimensions, glm::vec2 anchor, glm::vec3 colour)
 {
-    glUseProgram(program);
+    PROFILE_GPU_SCOPE("TextManager::draw_text");
+    GLState::use_program(program);
     glUniform2f(Position, float(window_dimensions.x), float(window_dimensions.y));
-    glActiveTexture(GL_TEXTURE0);
+    GLState::active_texture(GL_TEXTURE0);
     glUniform1i(TexCoord, 0);
 
     // Position of the cursor that is writing the text
@@ -155,10 +158,10 @@ void TextManager::draw_text(std::string str, glm::vec2 window_dimensions, glm::v
         hb_glyph_position_t *pos = hb_buffer_get_glyph_positions(hb_buffer, NULL);
 
         glUniform3f(Colour, colour.r, colour.g, colour.b);
-        glBindVertexArray(vao);
+        GLState::bind_vertex_array(vao);
 
         // Enable alpha blending for text rendering
-        glEnable(GL_BLEND);
+        GLState::enable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
         for (unsigned int i = 0; i < len; i++)
@@ -199,8 +202,8 @@ void TextManager::draw_text(std::string str, glm::vec2 window_dimensions, glm::v
                 x1, y1, 1.0f, 1.0f,
                 x0, y1, 0.0f, 1.0f};
 
-            glBindTexture(GL_TEXTURE_2D, glyph.tex_id);
-            glBindBuffer(GL_ARRAY_BUFFER, vbo);
+            GLState::bind_texture(GL_TEXTURE_2D, glyph.tex_id);
+            GLState::bind_buffer(GL_ARRAY_BUFFER, vbo);
             glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_DYNAMIC_DRAW);
             glDrawArrays(GL_TRIANGLES, 0, 6);
 
@@ -212,11 +215,9 @@ void TextManager::draw_text(std::string str, glm::vec2 window_dimensions, glm::v
         pen_y += font_size;
 
         hb_buffer_destroy(hb_buffer);
-        glBindVertexArray(0);
     }
 
-    glDisable(GL_BLEND);
-    glUseProgram(0);
+    GLState::disable(GL_BLEND);
 }
 
 std::vector<std::string> TextManager::wrap_text(std::string str, glm::vec2 window_dimensions, glm::vec2 anchor)
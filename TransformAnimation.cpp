@@ -2,8 +2,16 @@
 
 #include "read_write_chunk.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <fstream>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRANSFORM_ANIMATION_SSE2 1
+#endif
 
 TransformAnimation::TransformAnimation(std::string const &filename) {
 	std::ifstream file(filename, std::ios::binary);
@@ -28,6 +36,10 @@ TransformAnimation::TransformAnimation(std::string const &filename) {
 		names.emplace_back(strings_data.data() + e.begin, strings_data.data() + e.end);
 	}
 
+	if (names.empty()) {
+		throw std::runtime_error("Animation in '" + filename + "' has no channels.");
+	}
+
 	//frames_data gets read directly into this->frames_data:
 	read_chunk(file, "xff0", &frames_data);
 
@@ -91,4 +103,322 @@ void TransformAnimationPlayer::update(float elapsed) {
 			transforms[i]->scale = glm::mix(frame[i].scale, frame2[i].scale, amt);
 		}
 	}
-}
\ No newline at end of file
+}
+
+//------------------------------------------------
+
+//component c of a TRS, in track order (translation xyz, rotation xyzw, scale xyz):
+static float get_component(TransformAnimation::TRS const &trs, uint32_t c) {
+	switch (c) {
+		case 0: return trs.translation.x;
+		case 1: return trs.translation.y;
+		case 2: return trs.translation.z;
+		case 3: return trs.rotation.x;
+		case 4: return trs.rotation.y;
+		case 5: return trs.rotation.z;
+		case 6: return trs.rotation.w;
+		case 7: return trs.scale.x;
+		case 8: return trs.scale.y;
+		default: return trs.scale.z;
+	}
+}
+
+CompressedTransformAnimation::CompressedTransformAnimation(TransformAnimation const &animation) : names(animation.names), frames(animation.frames) {
+	uint32_t channels = uint32_t(names.size());
+	//(sampling always reads at least one frame):
+	if (frames == 0 || channels == 0) {
+		throw std::runtime_error("CompressedTransformAnimation: animation has " + std::to_string(frames) + " frames of " + std::to_string(channels) + " channels; need at least one of each.");
+	}
+	if (animation.frames_data.size() != size_t(frames) * channels) {
+		throw std::runtime_error("CompressedTransformAnimation: animation has " + std::to_string(animation.frames_data.size()) + " frame entries, expected " + std::to_string(size_t(frames) * channels) + ".");
+	}
+	std::vector< TransformAnimation::TRS > raw = animation.frames_data;
+
+	//keep each channel's rotation in the same hemisphere as the previous frame, so lerping between frames takes the short way:
+	for (uint32_t f = 1; f < frames; ++f) {
+		for (uint32_t c = 0; c < channels; ++c) {
+			glm::quat const &prev = raw[(f-1) * channels + c].rotation;
+			glm::quat &cur = raw[f * channels + c].rotation;
+			if (glm::dot(prev, cur) < 0.0f) cur = -cur;
+		}
+	}
+
+	//split tracks into constant and animated:
+	constants.assign(channels * TrackComponents, 0.0f);
+	std::vector< float > track_min, track_max;
+	for (uint32_t t = 0; t < channels * TrackComponents; ++t) {
+		uint32_t c = t / TrackComponents;
+		float min = get_component(raw[c], t % TrackComponents);
+		float max = min;
+		for (uint32_t f = 1; f < frames; ++f) {
+			float v = get_component(raw[f * channels + c], t % TrackComponents);
+			min = std::min(min, v);
+			max = std::max(max, v);
+		}
+		constants[t] = min;
+		if (max - min > 1e-6f) {
+			animated.emplace_back(t);
+			track_min.emplace_back(min);
+			track_max.emplace_back(max);
+		}
+	}
+
+	row = (uint32_t(animated.size()) + 7) & ~7U;
+	animated_min.assign(row, 0.0f);
+	animated_step.assign(row, 0.0f);
+	for (uint32_t k = 0; k < animated.size(); ++k) {
+		animated_min[k] = track_min[k];
+		animated_step[k] = (track_max[k] - track_min[k]) / 65535.0f;
+	}
+
+	frames_data.assign(size_t(frames) * row, 0);
+	for (uint32_t f = 0; f < frames; ++f) {
+		for (uint32_t k = 0; k < animated.size(); ++k) {
+			uint32_t t = animated[k];
+			float v = get_component(raw[f * channels + t / TrackComponents], t % TrackComponents);
+			float q = std::round((v - animated_min[k]) / animated_step[k]);
+			frames_data[size_t(f) * row + k] = uint16_t(std::clamp(q, 0.0f, 65535.0f));
+		}
+	}
+}
+
+//out[k] = min[k] + step[k] * mix(q0[k], q1[k], amt) for k in [0,count) (count is a multiple of 8):
+static void decode_rows(uint16_t const *q0, uint16_t const *q1, float amt, float const *min, float const *step, float *out, uint32_t count) {
+#ifdef TRANSFORM_ANIMATION_SSE2
+	__m128i const zero = _mm_setzero_si128();
+	__m128 const a = _mm_set1_ps(amt);
+	for (uint32_t k = 0; k < count; k += 8) {
+		__m128i v0 = _mm_loadu_si128(reinterpret_cast< __m128i const * >(q0 + k));
+		__m128i v1 = _mm_loadu_si128(reinterpret_cast< __m128i const * >(q1 + k));
+		__m128 lo0 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v0, zero));
+		__m128 hi0 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v0, zero));
+		__m128 lo1 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v1, zero));
+		__m128 hi1 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v1, zero));
+		__m128 lo = _mm_add_ps(lo0, _mm_mul_ps(_mm_sub_ps(lo1, lo0), a));
+		__m128 hi = _mm_add_ps(hi0, _mm_mul_ps(_mm_sub_ps(hi1, hi0), a));
+		_mm_storeu_ps(out + k, _mm_add_ps(_mm_loadu_ps(min + k), _mm_mul_ps(_mm_loadu_ps(step + k), lo)));
+		_mm_storeu_ps(out + k + 4, _mm_add_ps(_mm_loadu_ps(min + k + 4), _mm_mul_ps(_mm_loadu_ps(step + k + 4), hi)));
+	}
+#else
+	for (uint32_t k = 0; k < count; ++k) {
+		float a = float(q0[k]), b = float(q1[k]);
+		out[k] = min[k] + step[k] * (a + (b - a) * amt);
+	}
+#endif
+}
+
+void CompressedTransformAnimation::sample(float frame, TransformAnimation::TRS *out) const {
+	thread_local std::vector< float > values;
+	values.resize(constants.size());
+	sample_tracks(&frame, 1, values.data());
+	tracks_to_pose(values.data(), out);
+}
+
+void CompressedTransformAnimation::sample_tracks(float const *frames_, uint32_t count, float *values) const {
+	thread_local std::vector< float > decoded;
+	decoded.resize(row);
+
+	for (uint32_t i = 0; i < count; ++i) {
+		//same frame selection as TransformAnimationPlayer::update:
+		float frame = frames_[i];
+		int32_t iframe = int32_t(std::floor(frame));
+		int32_t iframe2 = iframe + 1;
+		float amt = frame - iframe;
+		if (iframe < 0) {
+			iframe = 0;
+			iframe2 = iframe;
+			amt = 0.0f;
+		}
+		if (iframe2 >= int32_t(frames)) {
+			iframe = int32_t(frames) - 1;
+			iframe2 = iframe;
+			amt = 0.0f;
+		}
+
+		//decode every animated track at once, then drop the values into place over the constants:
+		decode_rows(frames_data.data() + size_t(iframe) * row, frames_data.data() + size_t(iframe2) * row, amt,
+			animated_min.data(), animated_step.data(), decoded.data(), row);
+		float *out = values + size_t(i) * constants.size();
+		std::copy(constants.begin(), constants.end(), out);
+		for (uint32_t k = 0; k < animated.size(); ++k) {
+			out[animated[k]] = decoded[k];
+		}
+	}
+}
+
+void CompressedTransformAnimation::tracks_to_pose(float const *values, TransformAnimation::TRS *out) const {
+	for (uint32_t c = 0; c < names.size(); ++c) {
+		float const *v = values + c * TrackComponents;
+		out[c].translation = glm::vec3(v[0], v[1], v[2]);
+		out[c].rotation = glm::normalize(glm::quat(v[6], v[3], v[4], v[5])); //(n.b. wxyz constructor order)
+		out[c].scale = glm::vec3(v[7], v[8], v[9]);
+	}
+}
+
+size_t CompressedTransformAnimation::bytes() const {
+	return constants.size() * sizeof(float)
+	     + animated.size() * sizeof(uint32_t)
+	     + (animated_min.size() + animated_step.size()) * sizeof(float)
+	     + frames_data.size() * sizeof(uint16_t);
+}
+
+CompressedTransformAnimationPlayer::CompressedTransformAnimationPlayer(CompressedTransformAnimation const &animation_, std::vector< Scene::Transform * > const &transforms_, float speed) : animation(animation_), transforms(transforms_) {
+	if (transforms.size() != animation.names.size()) {
+		std::cerr << "WARNING: CompressedTransformAnimationPlayer was passed a list of " << transforms.size() << " transforms for an animation on " << animation.names.size() << " objects. Will trim / pad with null." << std::endl;
+		transforms.resize(animation.names.size(), nullptr);
+	}
+
+	frame = 0.0f;
+	frames_per_second = speed * 24.0f;
+	pose.resize(animation.names.size());
+}
+
+void CompressedTransformAnimationPlayer::update(float elapsed) {
+	frame += frames_per_second * elapsed;
+
+	animation.sample(frame, pose.data());
+	for (uint32_t i = 0; i < transforms.size(); ++i) {
+		if (transforms[i] != nullptr) {
+			transforms[i]->position = pose[i].translation;
+			transforms[i]->rotation = pose[i].rotation;
+			transforms[i]->scale = pose[i].scale;
+		}
+	}
+}
+
+//------------------------------------------------
+
+static void advance(TransformAnimationSystem::Playing &playing, float elapsed) {
+	playing.frame += playing.frames_per_second * elapsed;
+	if (playing.loop && playing.clip->frames > 1) {
+		float length = float(playing.clip->frames - 1);
+		playing.frame = std::fmod(playing.frame, length);
+		if (playing.frame < 0.0f) playing.frame += length;
+	}
+}
+
+TransformAnimationSystem::Instance TransformAnimationSystem::add(std::vector< Scene::Transform * > const &transforms_, CompressedTransformAnimation const &clip, float speed, bool loop, float start_frame) {
+	State state;
+	state.first = uint32_t(transforms.size());
+	state.channels = uint32_t(clip.names.size());
+	state.names = &clip.names;
+	if (transforms_.size() != clip.names.size()) {
+		std::cerr << "WARNING: TransformAnimationSystem was passed a list of " << transforms_.size() << " transforms for an animation on " << clip.names.size() << " objects. Will trim / pad with null." << std::endl;
+	}
+	for (uint32_t i = 0; i < state.channels; ++i) {
+		transforms.emplace_back(i < transforms_.size() ? transforms_[i] : nullptr);
+	}
+	state.current = Playing{ &clip, start_frame, speed * 24.0f, loop };
+	instances.emplace_back(state);
+	return Instance(instances.size() - 1);
+}
+
+void TransformAnimationSystem::play(Instance instance, CompressedTransformAnimation const &clip, float fade, float speed, bool loop, float start_frame) {
+	State &state = instances.at(instance);
+	if (clip.names.size() != state.channels) {
+		throw std::runtime_error("TransformAnimationSystem::play: clip has " + std::to_string(clip.names.size()) + " channels, but instance has " + std::to_string(state.channels) + ".");
+	}
+	//(same count isn't enough -- channels are matched to transforms by position, so the names must line up too):
+	for (uint32_t c = 0; c < state.channels; ++c) {
+		if (clip.names[c] != (*state.names)[c]) {
+			throw std::runtime_error("TransformAnimationSystem::play: clip's channel " + std::to_string(c) + " is '" + clip.names[c] + "', but instance's is '" + (*state.names)[c] + "'.");
+		}
+	}
+	if (fade > 0.0f) {
+		state.previous = state.current;
+		state.fade_remaining = state.fade_duration = fade;
+	} else {
+		state.fade_remaining = state.fade_duration = 0.0f;
+	}
+	state.current = Playing{ &clip, start_frame, speed * 24.0f, loop };
+}
+
+bool TransformAnimationSystem::done(Instance instance) const {
+	State const &state = instances.at(instance);
+	return !state.current.loop && state.current.frame >= state.current.clip->frames;
+}
+
+void TransformAnimationSystem::update(float elapsed) {
+	//advance playback and fades, and list everything that needs sampling:
+	batches.clear();
+	for (uint32_t i = 0; i < instances.size(); ++i) {
+		State &state = instances[i];
+		advance(state.current, elapsed);
+		batches.emplace_back(Batch{ state.current.clip, i, false });
+		if (state.fade_remaining > 0.0f) {
+			state.fade_remaining = std::max(0.0f, state.fade_remaining - elapsed);
+			advance(state.previous, elapsed);
+			if (state.fade_remaining > 0.0f) {
+				batches.emplace_back(Batch{ state.previous.clip, i, true });
+			}
+		}
+	}
+
+	//group by clip, so each clip is sampled for all of its instances in one call:
+	// (this only keeps the clip's data in cache; sample_tracks still decodes one instance at a time)
+	std::stable_sort(batches.begin(), batches.end(), [](Batch const &a, Batch const &b) {
+		return a.clip < b.clip;
+	});
+
+	//sample: batch_values gets each batch entry's tracks, in 'batches' order:
+	size_t total = 0;
+	for (auto const &b : batches) total += b.clip->constants.size();
+	batch_values.resize(total);
+	batch_offsets.resize(batches.size());
+	size_t offset = 0;
+	for (size_t begin = 0; begin < batches.size(); ) {
+		size_t end = begin;
+		batch_frames.clear();
+		while (end < batches.size() && batches[end].clip == batches[begin].clip) {
+			State const &state = instances[batches[end].instance];
+			batch_frames.emplace_back(batches[end].previous ? state.previous.frame : state.current.frame);
+			batch_offsets[end] = offset + (end - begin) * batches[begin].clip->constants.size();
+			++end;
+		}
+		batches[begin].clip->sample_tracks(batch_frames.data(), uint32_t(end - begin), batch_values.data() + offset);
+		offset += (end - begin) * batches[begin].clip->constants.size();
+		begin = end;
+	}
+
+	//blend (if fading) and write out each instance:
+	//  (entries for one instance may be anywhere in 'batches', so find them via a per-instance lookup)
+	current_at.assign(instances.size(), -1U);
+	previous_at.assign(instances.size(), -1U);
+	for (uint32_t b = 0; b < batches.size(); ++b) {
+		(batches[b].previous ? previous_at : current_at)[batches[b].instance] = b;
+	}
+	for (uint32_t i = 0; i < instances.size(); ++i) {
+		State const &state = instances[i];
+		CompressedTransformAnimation const &clip = *state.current.clip;
+		float const *values = batch_values.data() + batch_offsets[current_at[i]];
+
+		if (previous_at[i] != -1U) {
+			//cross-fade in track space (taking the short way between rotations):
+			float const *from = batch_values.data() + batch_offsets[previous_at[i]];
+			float t = 1.0f - state.fade_remaining / state.fade_duration;
+			blended.resize(clip.constants.size());
+			for (uint32_t c = 0; c < state.channels; ++c) {
+				float const *a = from + c * CompressedTransformAnimation::TrackComponents;
+				float const *b = values + c * CompressedTransformAnimation::TrackComponents;
+				float *o = blended.data() + c * CompressedTransformAnimation::TrackComponents;
+				float sign = (a[3] * b[3] + a[4] * b[4] + a[5] * b[5] + a[6] * b[6] < 0.0f ? -1.0f : 1.0f);
+				for (uint32_t k = 0; k < CompressedTransformAnimation::TrackComponents; ++k) {
+					float bk = (k >= 3 && k <= 6 ? sign * b[k] : b[k]);
+					o[k] = a[k] + (bk - a[k]) * t;
+				}
+			}
+			values = blended.data();
+		}
+
+		pose.resize(state.channels);
+		clip.tracks_to_pose(values, pose.data());
+		for (uint32_t c = 0; c < state.channels; ++c) {
+			Scene::Transform *transform = transforms[state.first + c];
+			if (transform != nullptr) {
+				transform->position = pose[c].translation;
+				transform->rotation = pose[c].rotation;
+				transform->scale = pose[c].scale;
+			}
+		}
+	}
+}
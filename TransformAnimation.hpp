@@ -18,13 +18,14 @@
 //contains transform animation data:
 struct TransformAnimation {
 	TransformAnimation(std::string const &filename); //load from a file; throws on error.
+	TransformAnimation() = default; //empty; fill in names / frames / frames_data by hand (e.g., for anim-check)
 	std::vector< std::string > names;
 	struct TRS {
 		glm::vec3 translation;
 		glm::quat rotation;
 		glm::vec3 scale;
 	};
-	uint32_t frames;
+	uint32_t frames = 0;
 	std::vector< TRS > frames_data; //raw frame data (names * frames) elements
 };
 
@@ -43,4 +44,107 @@ struct TransformAnimationPlayer {
 
 	bool done() const { return frame >= animation.frames; }
 
-};
\ No newline at end of file
+};
+
+//compact copy of a TransformAnimation for playback ("compiled" from the raw frames):
+// - each channel's translation (xyz), rotation (xyzw), and scale (xyz) are ten scalar tracks
+// - tracks that never change are stored once, as a constant
+// - the rest are quantized to 16 bits over their own [min,max] range and stored frame-major,
+//   so one frame of every animated track is a contiguous row that sample() decodes eight at a time
+// rotations are flipped into a consistent hemisphere, so sampling can lerp + normalize instead of slerp.
+struct CompressedTransformAnimation {
+	CompressedTransformAnimation(TransformAnimation const &animation);
+
+	enum : uint32_t { TrackComponents = 10 }; //tracks per channel
+
+	std::vector< std::string > names;
+	uint32_t frames = 0;
+
+	std::vector< float > constants; //value of every track (only used for tracks that don't animate)
+	std::vector< uint32_t > animated; //track index of each animated track
+	std::vector< float > animated_min, animated_step; //value = min + step * q (padded to a multiple of 8)
+	uint32_t row = 0; //stride of one frame in frames_data (animated.size() rounded up to a multiple of 8)
+	std::vector< uint16_t > frames_data; //frames x row quantized values
+
+	//evaluate every channel at (fractional) 'frame', holding the first/last frame when out of range:
+	// out must hold names.size() elements
+	void sample(float frame, TransformAnimation::TRS *out) const;
+
+	//...as raw track values (names.size() * TrackComponents floats per frame; rotations not yet normalized),
+	// for 'count' frames (e.g., many instances of this animation; each frame is still decoded on its own):
+	void sample_tracks(float const *frames, uint32_t count, float *values) const;
+	//...and turn one frame's track values into a pose:
+	void tracks_to_pose(float const *values, TransformAnimation::TRS *out) const;
+
+	//size of the compressed data (vs. frames * names.size() * sizeof(TRS) raw):
+	size_t bytes() const;
+};
+
+//same interface as TransformAnimationPlayer, but samples a CompressedTransformAnimation:
+struct CompressedTransformAnimationPlayer {
+	CompressedTransformAnimationPlayer(CompressedTransformAnimation const &animation, std::vector< Scene::Transform * > const &transforms, float speed = 1.0f);
+
+	CompressedTransformAnimation const &animation;
+	std::vector< Scene::Transform * > transforms;
+
+	float frame = 0.0f;
+	float frames_per_second = 24.0f;
+
+	//advance playback by 'elapsed' seconds, set transforms:
+	void update(float elapsed);
+
+	bool done() const { return frame >= animation.frames; }
+
+	std::vector< TransformAnimation::TRS > pose; //scratch for sample()
+};
+
+//plays CompressedTransformAnimations ("clips") on many sets of transforms ("instances") at once:
+// - clips are shared, not copied; an instance is a small record plus its transforms' slots in one flat array
+// - play() cross-fades an instance from whatever it was playing to a new clip
+// - update() samples instances grouped by clip (one sample_tracks() call per clip, so each clip's data stays
+//   in cache while its instances are decoded -- the decoding itself is still one instance at a time)
+// Every clip played on an instance must have the same channels (names, in order) as the transforms it was added with.
+struct TransformAnimationSystem {
+	typedef uint32_t Instance;
+
+	//start playing 'clip' on 'transforms' (in the clip's channel order; null entries are skipped):
+	Instance add(std::vector< Scene::Transform * > const &transforms, CompressedTransformAnimation const &clip, float speed = 1.0f, bool loop = true, float start_frame = 0.0f);
+
+	//switch to 'clip', blending from the current pose over 'fade' seconds:
+	// throws if the clip's channel names don't match the clip the instance was added with
+	void play(Instance instance, CompressedTransformAnimation const &clip, float fade = 0.0f, float speed = 1.0f, bool loop = true, float start_frame = 0.0f);
+
+	//advance every instance by 'elapsed' seconds and set transforms:
+	void update(float elapsed);
+
+	bool done(Instance instance) const;
+
+	struct Playing {
+		CompressedTransformAnimation const *clip = nullptr;
+		float frame = 0.0f;
+		float frames_per_second = 24.0f;
+		bool loop = true;
+	};
+	struct State {
+		uint32_t first = 0; //first transform in 'transforms'
+		uint32_t channels = 0;
+		std::vector< std::string > const *names = nullptr; //channel names of the clip passed to add() (play() checks against these)
+		Playing current;
+		Playing previous; //clip being faded out (if fade_remaining > 0)
+		float fade_remaining = 0.0f, fade_duration = 0.0f;
+	};
+	std::vector< State > instances;
+	std::vector< Scene::Transform * > transforms; //all instances' transforms, back to back
+
+	//scratch, reused each update:
+	struct Batch {
+		CompressedTransformAnimation const *clip;
+		uint32_t instance;
+		bool previous; //sampling the instance's fading-out clip
+	};
+	std::vector< Batch > batches;
+	std::vector< float > batch_frames, batch_values, blended;
+	std::vector< size_t > batch_offsets; //start of each batch entry's tracks in batch_values
+	std::vector< uint32_t > current_at, previous_at; //batch entry of each instance's current / fading-out clip
+	std::vector< TransformAnimation::TRS > pose;
+};
@@ -0,0 +1,255 @@
+#include "UIBatch.hpp"
+
+#include "ColorTextureProgram.hpp"
+#include "Profiler.hpp"
+#include "gl_errors.hpp"
+#include "GLState.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+//padding (in pixels) around each image in the atlas, so mipmaps don't bleed between images:
+static constexpr uint32_t AtlasPadding = 4;
+
+UIBatch::~UIBatch() {
+	if (vertex_buffer_for_color_texture_program) {
+		GLState::delete_vertex_arrays(1, &vertex_buffer_for_color_texture_program);
+		vertex_buffer_for_color_texture_program = 0;
+	}
+	if (vertex_buffer) {
+		GLState::delete_buffers(1, &vertex_buffer);
+		vertex_buffer = 0;
+	}
+	if (atlas_tex) {
+		GLState::delete_textures(1, &atlas_tex);
+		atlas_tex = 0;
+	}
+}
+
+uint32_t UIBatch::add_image(std::string const &filename) {
+	images.emplace_back();
+	Image &image = images.back();
+
+	//LowerLeftOrigin puts rows in the order glTexImage2D expects, so no repacking is needed;
+	// the UI never shows images at full resolution, so the loader also box-filters down to max_image_size:
+	AsyncImage::Options options;
+	options.origin = LowerLeftOrigin;
+	options.max_size = max_image_size;
+	options.make_texture = false; //pixels are packed into the atlas instead
+	image.source = AsyncImage::load(filename, options);
+
+	atlas_dirty = true;
+	return uint32_t(images.size() - 1);
+}
+
+uint32_t UIBatch::add_quad(uint32_t image, glm::vec2 const &clip_center, float clip_height, glm::u8vec4 const &tint) {
+	if (image >= images.size()) throw std::runtime_error("UIBatch quad references image " + std::to_string(image) + " but only " + std::to_string(images.size()) + " images were added.");
+	quads.emplace_back();
+	Quad &quad = quads.back();
+	quad.image = image;
+	quad.clip_center = clip_center;
+	quad.clip_height = clip_height;
+	quad.tint = tint;
+	return uint32_t(quads.size() - 1);
+}
+
+void UIBatch::set_image(uint32_t quad, uint32_t image) {
+	assert(quad < quads.size() && image < images.size());
+	if (quads[quad].image == image) return;
+	quads[quad].image = image;
+}
+
+void UIBatch::set_position(uint32_t quad, glm::vec2 const &clip_center, float clip_height) {
+	assert(quad < quads.size());
+	quads[quad].clip_center = clip_center;
+	quads[quad].clip_height = clip_height;
+}
+
+void UIBatch::set_visible(uint32_t quad, bool visible) {
+	assert(quad < quads.size());
+	if (quads[quad].visible == visible) return;
+	quads[quad].visible = visible;
+}
+
+bool UIBatch::build_atlas() {
+	//images that were already packed have had their source released, so re-pack only works if every image still has one:
+	for (auto &image : images) {
+		if (!image.source) {
+			throw std::runtime_error("UIBatch can't re-pack an atlas after its image data was released; add all images before the first draw.");
+		}
+		if (image.source->failed()) {
+			throw std::runtime_error("UIBatch failed to load image '" + image.source->filename + "': " + image.source->error);
+		}
+		if (!image.source->decoded()) return false; //still loading; try again next draw
+		image.size = image.source->size;
+	}
+
+	atlas_dirty = false;
+	layout_dirty = true;
+
+	GLint max_texture_size = 0;
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+
+	//shelf packing, tallest images first:
+	std::vector< uint32_t > order(images.size());
+	uint64_t total_area = 0;
+	uint32_t widest = 1;
+	for (uint32_t i = 0; i < images.size(); ++i) {
+		order[i] = i;
+		total_area += uint64_t(images[i].size.x + AtlasPadding) * uint64_t(images[i].size.y + AtlasPadding);
+		widest = std::max(widest, images[i].size.x + AtlasPadding);
+	}
+	std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b){
+		return images[a].size.y > images[b].size.y;
+	});
+
+	uint32_t width = 1;
+	while (width < widest || uint64_t(width) * uint64_t(width) < total_area) width *= 2;
+
+	uint32_t height = 0;
+	{ //place images on shelves:
+		uint32_t shelf_x = 0, shelf_y = 0, shelf_height = 0;
+		for (uint32_t i : order) {
+			Image &image = images[i];
+			glm::uvec2 padded = image.size + glm::uvec2(AtlasPadding);
+			if (shelf_x + padded.x > width) {
+				shelf_y += shelf_height;
+				shelf_x = 0;
+				shelf_height = 0;
+			}
+			image.atlas_min = glm::uvec2(shelf_x, shelf_y) + glm::uvec2(AtlasPadding / 2);
+			shelf_x += padded.x;
+			shelf_height = std::max(shelf_height, padded.y);
+		}
+		height = std::max(1U, shelf_y + shelf_height);
+	}
+
+	if (width > uint32_t(max_texture_size) || height > uint32_t(max_texture_size)) {
+		throw std::runtime_error("UIBatch atlas (" + std::to_string(width) + "x" + std::to_string(height) + ") exceeds GL_MAX_TEXTURE_SIZE (" + std::to_string(max_texture_size) + "); lower max_image_size.");
+	}
+	atlas_size = glm::uvec2(width, height);
+
+	//compose the atlas on the CPU so it can be uploaded with one call:
+	std::vector< glm::u8vec4 > atlas(width * height, glm::u8vec4(0x00));
+	for (auto &image : images) {
+		std::vector< glm::u8vec4 > const &data = image.source->data;
+		for (uint32_t y = 0; y < image.size.y; ++y) {
+			std::copy(
+				data.begin() + y * image.size.x,
+				data.begin() + (y + 1) * image.size.x,
+				atlas.begin() + (image.atlas_min.y + y) * width + image.atlas_min.x
+			);
+		}
+		image.tex_min = glm::vec2(image.atlas_min) / glm::vec2(atlas_size);
+		image.tex_max = glm::vec2(image.atlas_min + image.size) / glm::vec2(atlas_size);
+
+		//pixels live on the GPU from now on:
+		image.source.reset();
+	}
+
+	if (atlas_tex == 0) glGenTextures(1, &atlas_tex);
+	AsyncImage::upload_rgba(atlas_tex, atlas_size, atlas.data(), GL_SRGB8_ALPHA8);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glGenerateMipmap(GL_TEXTURE_2D);
+	GLState::bind_texture(GL_TEXTURE_2D, 0);
+
+	GL_ERRORS();
+
+	return true;
+}
+
+void UIBatch::update_layout(glm::uvec2 const &drawable_size, std::vector< Quad > const &frame_quads) {
+	layout_dirty = false;
+	layout_quads = frame_quads;
+	layout_drawable_size = drawable_size;
+
+	if (vertex_buffer == 0) {
+		glGenBuffers(1, &vertex_buffer);
+
+		glGenVertexArrays(1, &vertex_buffer_for_color_texture_program);
+		GLState::bind_vertex_array(vertex_buffer_for_color_texture_program);
+		GLState::bind_buffer(GL_ARRAY_BUFFER, vertex_buffer);
+		glVertexAttribPointer(color_texture_program->Position_vec4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Position));
+		glEnableVertexAttribArray(color_texture_program->Position_vec4);
+		glVertexAttribPointer(color_texture_program->Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Color));
+		glEnableVertexAttribArray(color_texture_program->Color_vec4);
+		glVertexAttribPointer(color_texture_program->TexCoord_vec2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, TexCoord));
+		glEnableVertexAttribArray(color_texture_program->TexCoord_vec2);
+		GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
+		GLState::bind_vertex_array(0);
+	}
+
+	//clip-space width of one unit of clip-space height, given the drawable's aspect:
+	float aspect = float(drawable_size.y) / float(std::max(1U, drawable_size.x));
+
+	attribs.clear();
+	attribs.reserve(frame_quads.size() * 6);
+	for (auto const &quad : frame_quads) {
+		if (!quad.visible) continue;
+		Image const &image = images[quad.image];
+		if (image.size.y == 0) continue;
+
+		float clip_width = aspect * quad.clip_height * float(image.size.x) / float(image.size.y);
+		glm::vec2 min = quad.clip_center - 0.5f * glm::vec2(clip_width, quad.clip_height);
+		glm::vec2 max = quad.clip_center + 0.5f * glm::vec2(clip_width, quad.clip_height);
+
+		//two triangles per quad so that all quads can go in one GL_TRIANGLES draw:
+		Vertex bl{ glm::vec2(min.x, min.y), quad.tint, glm::vec2(image.tex_min.x, image.tex_min.y) };
+		Vertex tl{ glm::vec2(min.x, max.y), quad.tint, glm::vec2(image.tex_min.x, image.tex_max.y) };
+		Vertex br{ glm::vec2(max.x, min.y), quad.tint, glm::vec2(image.tex_max.x, image.tex_min.y) };
+		Vertex tr{ glm::vec2(max.x, max.y), quad.tint, glm::vec2(image.tex_max.x, image.tex_max.y) };
+		attribs.emplace_back(bl);
+		attribs.emplace_back(br);
+		attribs.emplace_back(tr);
+		attribs.emplace_back(bl);
+		attribs.emplace_back(tr);
+		attribs.emplace_back(tl);
+	}
+
+	GLState::bind_buffer(GL_ARRAY_BUFFER, vertex_buffer);
+	glBufferData(GL_ARRAY_BUFFER, attribs.size() * sizeof(Vertex), attribs.data(), GL_DYNAMIC_DRAW);
+	GLState::bind_buffer(GL_ARRAY_BUFFER, 0);
+
+	GL_ERRORS();
+}
+
+void UIBatch::draw(glm::uvec2 const &drawable_size) {
+	draw(drawable_size, quads);
+}
+
+void UIBatch::draw(glm::uvec2 const &drawable_size, std::vector< Quad > const &frame_quads) {
+	if (frame_quads.empty()) return;
+	PROFILE_GPU_SCOPE("UIBatch::draw");
+
+	if (atlas_dirty && !build_atlas()) return;
+	if (layout_dirty || drawable_size != layout_drawable_size || frame_quads != layout_quads) update_layout(drawable_size, frame_quads);
+	if (attribs.empty()) return;
+
+	GLState::use_program(color_texture_program->program);
+	GLState::bind_vertex_array(vertex_buffer_for_color_texture_program);
+	GLState::active_texture(GL_TEXTURE0);
+	GLState::bind_texture(GL_TEXTURE_2D, atlas_tex);
+
+	//quad positions are already in clip space:
+	glUniformMatrix4fv(color_texture_program->OBJECT_TO_CLIP_mat4, 1, GL_FALSE, glm::value_ptr(glm::mat4(1.0f)));
+
+	//draw without depth testing (so will draw atop everything else), with standard 'over' blending:
+	GLState::disable(GL_DEPTH_TEST);
+	GLState::enable(GL_BLEND);
+	glBlendEquation(GL_FUNC_ADD);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	glDrawArrays(GL_TRIANGLES, 0, GLsizei(attribs.size()));
+
+	GLState::disable(GL_BLEND);
+	//...leave depth test off, since code that wants it will turn it back on
+	//...and leave the program, vertex array, and atlas bound (GLState skips re-binding them next frame)
+
+	GL_ERRORS();
+}
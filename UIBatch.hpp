@@ -0,0 +1,106 @@
+#pragma once
+
+/*
+ * UIBatch collects all of the screen-space UI quads for a frame (e.g., the wine
+ * bottle timer) into a single dynamic vertex buffer that references one shared
+ * atlas texture, so the whole UI is drawn with a single glDrawArrays call.
+ *
+ * Usage:
+ *   //at setup:
+ *   uint32_t full = ui.add_image(data_path("wine_bottle_5.png"));
+ *   uint32_t empty = ui.add_image(data_path("wine_bottle_0.png"));
+ *   uint32_t bottle = ui.add_quad(full, glm::vec2(0.9f, 0.6f), 0.8f);
+ *   //later (cheap -- no texture upload):
+ *   ui.set_image(bottle, empty);
+ *   //in draw:
+ *   ui.draw(drawable_size);
+ *
+ * Images are decoded asynchronously (see AsyncImage.hpp); the atlas is built
+ * on the first draw after all added images have finished decoding (nothing is
+ * drawn until then), and quad vertices are only rebuilt when a quad changes or
+ * the drawable is resized.
+ *
+ */
+
+#include "GL.hpp"
+#include "AsyncImage.hpp"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct UIBatch {
+	UIBatch() = default;
+	~UIBatch();
+
+	//GL objects are owned by the batch, so copying is not allowed:
+	UIBatch(UIBatch const &) = delete;
+	UIBatch &operator=(UIBatch const &) = delete;
+
+	//images larger than this (in either dimension) are box-filtered down by powers of two (on the loader thread):
+	uint32_t max_image_size = 1024;
+
+	//start loading an image for the atlas; returns an image index for use with add_quad / set_image:
+	// (returns immediately; draw throws if the png can't be loaded)
+	uint32_t add_image(std::string const &filename);
+
+	//add a quad showing 'image', centered at 'clip_center' and 'clip_height' tall (in clip space);
+	// the width is computed from the image's aspect ratio and the drawable's aspect ratio:
+	uint32_t add_quad(uint32_t image, glm::vec2 const &clip_center, float clip_height, glm::u8vec4 const &tint = glm::u8vec4(0xff));
+
+	//change the properties of an existing quad:
+	void set_image(uint32_t quad, uint32_t image);
+	void set_position(uint32_t quad, glm::vec2 const &clip_center, float clip_height);
+	void set_visible(uint32_t quad, bool visible);
+
+	//draw all visible quads (atop everything else, with alpha blending):
+	void draw(glm::uvec2 const &drawable_size);
+	//...or draw 'frame_quads', a copy of quads taken earlier (e.g., recorded on the main thread for a render thread);
+	// this only reads images and the GL-side members below, so set_* may change 'quads' meanwhile:
+	struct Quad;
+	void draw(glm::uvec2 const &drawable_size, std::vector< Quad > const &frame_quads);
+
+	//---- internals ----
+
+	struct Image {
+		std::shared_ptr< AsyncImage::Image > source; //decoded pixels (lower-left origin), released after packing into the atlas
+		glm::uvec2 size = glm::uvec2(0);
+		glm::uvec2 atlas_min = glm::uvec2(0); //pixel location in atlas
+		glm::vec2 tex_min = glm::vec2(0.0f), tex_max = glm::vec2(0.0f); //texcoord range in atlas
+	};
+	std::vector< Image > images;
+
+	struct Quad {
+		uint32_t image = 0;
+		glm::vec2 clip_center = glm::vec2(0.0f);
+		float clip_height = 0.0f;
+		glm::u8vec4 tint = glm::u8vec4(0xff);
+		bool visible = true;
+		bool operator==(Quad const &) const = default;
+	};
+	std::vector< Quad > quads;
+
+	//vertex format for color_texture_program (positions are already in clip space):
+	struct Vertex {
+		glm::vec2 Position;
+		glm::u8vec4 Color;
+		glm::vec2 TexCoord;
+	};
+	static_assert(sizeof(Vertex) == 4*2 + 4*1 + 4*2, "UIBatch::Vertex is packed.");
+	std::vector< Vertex > attribs;
+
+	bool atlas_dirty = false; //images added since last atlas build
+	bool layout_dirty = true; //atlas changed since last vertex upload
+	std::vector< Quad > layout_quads; //quads used for last layout (vertices are rebuilt when these change)
+	glm::uvec2 layout_drawable_size = glm::uvec2(0); //drawable size used for last layout
+
+	GLuint atlas_tex = 0;
+	glm::uvec2 atlas_size = glm::uvec2(0);
+	GLuint vertex_buffer = 0;
+	GLuint vertex_buffer_for_color_texture_program = 0;
+
+	bool build_atlas(); //pack images (shelf packing) and upload atlas texture; returns false if images are still loading
+	void update_layout(glm::uvec2 const &drawable_size, std::vector< Quad > const &frame_quads); //rebuild + upload quad vertices
+};
@@ -0,0 +1,199 @@
+//Checks for CompressedTransformAnimation and TransformAnimationSystem:
+// - quantized clips decode to within their quantization step of the source frames
+//   (and stay close to slerp between frames, even where the source flips quaternion signs)
+// - cross-fades between clips whose rotations are stored in opposite hemispheres take the short way
+// - play() rejects clips whose channels don't match, and empty animations are rejected
+//
+//Usage:
+//  anim-check
+//
+//Doesn't open a window (or touch OpenGL); prints each failure and returns nonzero if there were any.
+
+#include "TransformAnimation.hpp"
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+static uint32_t failures = 0;
+
+static void check(bool ok, std::string const &what) {
+	if (!ok) {
+		std::cout << "FAILED: " << what << std::endl;
+		failures += 1;
+	}
+}
+
+//angle (radians) between the rotations represented by two (unit) quaternions:
+static float angle_between(glm::quat const &a, glm::quat const &b) {
+	float d = std::min(1.0f, std::abs(glm::dot(glm::normalize(a), glm::normalize(b))));
+	return 2.0f * std::acos(d);
+}
+
+static float max_abs(glm::vec3 const &v) {
+	return std::max(std::abs(v.x), std::max(std::abs(v.y), std::abs(v.z)));
+}
+
+//three channels over 'frames' frames: one moving (with a rotation whose stored sign flips every frame),
+// one constant, and one spinning past 180 degrees:
+static TransformAnimation make_animation(uint32_t frames) {
+	TransformAnimation animation;
+	animation.names = { "Body", "Base", "Spinner" };
+	animation.frames = frames;
+	for (uint32_t f = 0; f < frames; ++f) {
+		float t = float(f) / float(frames - 1);
+
+		TransformAnimation::TRS body;
+		body.translation = glm::vec3(3.0f * std::sin(6.0f * t), -2.0f + 4.0f * t, 0.5f * std::cos(9.0f * t));
+		body.rotation = glm::angleAxis(1.5f * std::sin(5.0f * t), glm::normalize(glm::vec3(1.0f, 2.0f, 0.5f)));
+		if (f % 2 == 1) body.rotation = -body.rotation; //same rotation, other hemisphere
+		body.scale = glm::vec3(1.0f + 0.25f * t);
+
+		TransformAnimation::TRS base;
+		base.translation = glm::vec3(0.0f, 0.0f, -1.0f);
+		base.rotation = glm::angleAxis(0.3f, glm::vec3(0.0f, 0.0f, 1.0f));
+		base.scale = glm::vec3(2.0f);
+
+		TransformAnimation::TRS spinner;
+		spinner.translation = glm::vec3(0.0f);
+		spinner.rotation = glm::angleAxis(6.0f * t, glm::vec3(0.0f, 1.0f, 0.0f)); //a bit less than a full turn
+		spinner.scale = glm::vec3(1.0f);
+
+		animation.frames_data.emplace_back(body);
+		animation.frames_data.emplace_back(base);
+		animation.frames_data.emplace_back(spinner);
+	}
+	return animation;
+}
+
+static void check_round_trip() {
+	TransformAnimation animation = make_animation(48);
+	CompressedTransformAnimation compressed(animation);
+	uint32_t channels = uint32_t(animation.names.size());
+
+	//largest quantization step of any animated track (errors at whole frames should be at most half of this):
+	float step = 0.0f;
+	for (float s : compressed.animated_step) step = std::max(step, s);
+	check(compressed.bytes() < animation.frames_data.size() * sizeof(TransformAnimation::TRS), "compressed clip is smaller than the raw frames");
+
+	std::vector< TransformAnimation::TRS > pose(channels);
+
+	//whole frames -- only quantization error:
+	for (uint32_t f = 0; f < animation.frames; ++f) {
+		compressed.sample(float(f), pose.data());
+		for (uint32_t c = 0; c < channels; ++c) {
+			TransformAnimation::TRS const &source = animation.frames_data[f * channels + c];
+			std::string where = animation.names[c] + " at frame " + std::to_string(f);
+			check(max_abs(pose[c].translation - source.translation) <= 0.5f * step + 1e-5f, where + ": translation within quantization error");
+			check(max_abs(pose[c].scale - source.scale) <= 0.5f * step + 1e-5f, where + ": scale within quantization error");
+			check(angle_between(pose[c].rotation, source.rotation) < 1e-3f, where + ": rotation within quantization error");
+		}
+	}
+
+	//between frames -- lerp + normalize vs. short-way slerp of the source:
+	for (uint32_t f = 0; f + 1 < animation.frames; ++f) {
+		for (float amt : { 0.25f, 0.5f, 0.75f }) {
+			compressed.sample(float(f) + amt, pose.data());
+			for (uint32_t c = 0; c < channels; ++c) {
+				TransformAnimation::TRS const &a = animation.frames_data[f * channels + c];
+				TransformAnimation::TRS const &b = animation.frames_data[(f + 1) * channels + c];
+				glm::quat b_rotation = (glm::dot(a.rotation, b.rotation) < 0.0f ? -b.rotation : b.rotation);
+				std::string where = animation.names[c] + " at frame " + std::to_string(float(f) + amt);
+				check(max_abs(pose[c].translation - glm::mix(a.translation, b.translation, amt)) <= step + 1e-5f, where + ": translation");
+				check(angle_between(pose[c].rotation, glm::slerp(a.rotation, b_rotation, amt)) < 1e-2f, where + ": rotation close to short-way slerp");
+			}
+		}
+	}
+
+	//out of range holds the first / last frame:
+	compressed.sample(-3.0f, pose.data());
+	check(max_abs(pose[0].translation - animation.frames_data[0].translation) <= 0.5f * step + 1e-5f, "frames before the start hold the first frame");
+	compressed.sample(float(animation.frames) + 10.0f, pose.data());
+	check(max_abs(pose[0].translation - animation.frames_data[(animation.frames - 1) * channels].translation) <= 0.5f * step + 1e-5f, "frames past the end hold the last frame");
+}
+
+//a one-channel, two-frame clip holding one pose:
+static TransformAnimation make_pose(std::string const &name, glm::vec3 const &translation, glm::quat const &rotation) {
+	TransformAnimation animation;
+	animation.names = { name };
+	animation.frames = 2;
+	TransformAnimation::TRS trs;
+	trs.translation = translation;
+	trs.rotation = rotation;
+	trs.scale = glm::vec3(1.0f);
+	animation.frames_data = { trs, trs };
+	return animation;
+}
+
+static void check_cross_fade() {
+	glm::vec3 const z = glm::vec3(0.0f, 0.0f, 1.0f);
+	glm::quat from_rotation = glm::angleAxis(glm::radians(30.0f), z);
+	glm::quat to_rotation = glm::angleAxis(glm::radians(60.0f), z);
+
+	CompressedTransformAnimation from(make_pose("Bone", glm::vec3(0.0f), from_rotation));
+	//stored in the opposite hemisphere -- a naive lerp of the quaternions would pass near zero:
+	CompressedTransformAnimation to(make_pose("Bone", glm::vec3(2.0f, 0.0f, 0.0f), -to_rotation));
+
+	Scene::Transform transform;
+	TransformAnimationSystem system;
+	TransformAnimationSystem::Instance instance = system.add({ &transform }, from);
+	system.update(0.1f);
+	check(angle_between(transform.rotation, from_rotation) < 1e-3f, "before the fade, the first clip's pose");
+
+	system.play(instance, to, 1.0f);
+	system.update(0.5f);
+	check(max_abs(transform.position - glm::vec3(1.0f, 0.0f, 0.0f)) < 1e-3f, "halfway through the fade, translation is halfway");
+	check(angle_between(transform.rotation, glm::angleAxis(glm::radians(45.0f), z)) < 1e-2f, "halfway through the fade, rotation is halfway (the short way)");
+
+	system.update(0.75f);
+	check(max_abs(transform.position - glm::vec3(2.0f, 0.0f, 0.0f)) < 1e-3f, "after the fade, the second clip's translation");
+	check(angle_between(transform.rotation, to_rotation) < 1e-3f, "after the fade, the second clip's rotation");
+}
+
+static void check_rejects() {
+	CompressedTransformAnimation arm(make_pose("Arm", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f)));
+	CompressedTransformAnimation other(make_pose("Leg", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f)));
+
+	Scene::Transform transform;
+	TransformAnimationSystem system;
+	TransformAnimationSystem::Instance instance = system.add({ &transform }, arm);
+	bool threw = false;
+	try {
+		system.play(instance, other);
+	} catch (std::runtime_error &) {
+		threw = true;
+	}
+	check(threw, "play() throws for a clip with different channel names");
+
+	TransformAnimation empty;
+	empty.names = { "Arm" };
+	threw = false;
+	try {
+		CompressedTransformAnimation compressed(empty);
+	} catch (std::runtime_error &) {
+		threw = true;
+	}
+	check(threw, "compressing an animation with zero frames throws");
+}
+
+int main(int argc, char **argv) {
+	if (argc != 1) {
+		std::cerr << "Usage:\n\t" << argv[0] << std::endl;
+		return 1;
+	}
+
+	check_round_trip();
+	check_cross_fade();
+	check_rejects();
+
+	if (failures != 0) {
+		std::cout << failures << " check" << (failures == 1 ? "" : "s") << " failed." << std::endl;
+		return 1;
+	}
+	std::cout << "All animation checks passed." << std::endl;
+	return 0;
+}
@@ -1,19 +1,23 @@
 #include "bone_vertex_color_program.hpp"
 
-#include "compile_program.hpp"
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+#include "GLState.hpp"
 
-#ifndef STR
-#define STR2(X) #X
-#define STR(X) STR2(X)
-#endif
+#include <glm/gtc/type_ptr.hpp>
+
+#include <stdexcept>
+#include <string>
+
+Load< BoneVertexColorProgram > bone_vertex_color_program(LoadTagEarly);
 
 BoneVertexColorProgram::BoneVertexColorProgram() {
-	program = compile_program(
+	program = gl_compile_program(
 		"#version 330\n"
-		"uniform mat4 object_to_clip;\n"
-		"uniform mat4x3 object_to_light;\n"
-		"uniform mat3 normal_to_light;\n"
-		"uniform mat4x3 bones[" STR( BONE_LIMIT ) "];\n"
+		"uniform mat4 CLIP_FROM_WORLD;\n"
+		"uniform samplerBuffer BONES;\n"
+		"uniform int BONE_BASE;\n"
+		"uniform int BONE_COUNT;\n"
 		"layout(location=0) in vec4 Position;\n" //note: layout keyword used to make sure that the location-0 attribute is always bound to something
 		"in vec3 Normal;\n"
 		"in vec4 Color;\n"
@@ -22,28 +26,36 @@ BoneVertexColorProgram::BoneVertexColorProgram() {
 		"out vec3 position;\n"
 		"out vec3 normal;\n"
 		"out vec4 color;\n"
+		"mat4x3 bone(uint index) {\n"
+		"	int at = 3 * (BONE_BASE + gl_InstanceID * BONE_COUNT + int(index));\n"
+		"	return transpose(mat3x4(texelFetch(BONES, at), texelFetch(BONES, at+1), texelFetch(BONES, at+2)));\n"
+		"}\n"
 		"void main() {\n"
+		"	mat4x3 b0 = bone(BoneIndices.x);\n"
+		"	mat4x3 b1 = bone(BoneIndices.y);\n"
+		"	mat4x3 b2 = bone(BoneIndices.z);\n"
+		"	mat4x3 b3 = bone(BoneIndices.w);\n"
 		"	vec3 blended_Position = \n"
-		"		( BoneWeights.x * bones[ BoneIndices.x ]\n"
-		"		+ BoneWeights.y * bones[ BoneIndices.y ]\n"
-		"		+ BoneWeights.z * bones[ BoneIndices.z ]\n"
-		"		+ BoneWeights.w * bones[ BoneIndices.w ] ) * Position;\n"
+		"		( BoneWeights.x * b0\n"
+		"		+ BoneWeights.y * b1\n"
+		"		+ BoneWeights.z * b2\n"
+		"		+ BoneWeights.w * b3 ) * Position;\n"
 		"	vec3 blended_Normal = \n"
-		"		( BoneWeights.x * mat3(bones[ BoneIndices.x ])\n"
-		"		+ BoneWeights.y * mat3(bones[ BoneIndices.y ])\n"
-		"		+ BoneWeights.z * mat3(bones[ BoneIndices.z ])\n"
-		"		+ BoneWeights.w * mat3(bones[ BoneIndices.w ]) ) * Normal;\n" //<-- note: not correct if bones do scaling
-		"	gl_Position = object_to_clip * vec4(blended_Position, 1.0);\n"
-		"	position = object_to_light * vec4(blended_Position, 1.0);\n"
-		"	normal = normal_to_light * blended_Normal;\n"
+		"		( BoneWeights.x * mat3(b0)\n"
+		"		+ BoneWeights.y * mat3(b1)\n"
+		"		+ BoneWeights.z * mat3(b2)\n"
+		"		+ BoneWeights.w * mat3(b3) ) * Normal;\n" //<-- note: not correct if bones do scaling
+		"	gl_Position = CLIP_FROM_WORLD * vec4(blended_Position, 1.0);\n"
+		"	position = blended_Position;\n"
+		"	normal = blended_Normal;\n"
 		"	color = Color;\n"
 		"}\n"
 		,
 		"#version 330\n"
-		"uniform vec3 sun_direction;\n"
-		"uniform vec3 sun_color;\n"
-		"uniform vec3 sky_direction;\n"
-		"uniform vec3 sky_color;\n"
+		"uniform vec3 SUN_DIRECTION;\n"
+		"uniform vec3 SUN_COLOR;\n"
+		"uniform vec3 SKY_DIRECTION;\n"
+		"uniform vec3 SKY_COLOR;\n"
 		"in vec3 position;\n"
 		"in vec3 normal;\n"
 		"in vec4 color;\n"
@@ -52,31 +64,120 @@ BoneVertexColorProgram::BoneVertexColorProgram() {
 		"	vec3 total_light = vec3(0.0, 0.0, 0.0);\n"
 		"	vec3 n = normalize(normal);\n"
 		"	{ //sky (hemisphere) light:\n"
-		"		vec3 l = sky_direction;\n"
+		"		vec3 l = SKY_DIRECTION;\n"
 		"		float nl = 0.5 + 0.5 * dot(n,l);\n"
-		"		total_light += nl * sky_color;\n"
+		"		total_light += nl * SKY_COLOR;\n"
 		"	}\n"
 		"	{ //sun (directional) light:\n"
-		"		vec3 l = sun_direction;\n"
+		"		vec3 l = SUN_DIRECTION;\n"
 		"		float nl = max(0.0, dot(n,l));\n"
-		"		total_light += nl * sun_color;\n"
+		"		total_light += nl * SUN_COLOR;\n"
 		"	}\n"
 		"	fragColor = vec4(color.rgb * total_light, color.a);\n"
-		"}\n"
+		"}\n",
+		"bone_vertex_color"
 	);
 
-	object_to_clip_mat4 = glGetUniformLocation(program, "object_to_clip");
-	object_to_light_mat4x3 = glGetUniformLocation(program, "object_to_light");
-	normal_to_light_mat3 = glGetUniformLocation(program, "normal_to_light");
+	CLIP_FROM_WORLD_mat4 = glGetUniformLocation(program, "CLIP_FROM_WORLD");
+	BONES_samplerBuffer = glGetUniformLocation(program, "BONES");
+	BONE_BASE_int = glGetUniformLocation(program, "BONE_BASE");
+	BONE_COUNT_int = glGetUniformLocation(program, "BONE_COUNT");
 
-	bones_mat4x3_array = glGetUniformLocation(program, "bones");
+	SUN_DIRECTION_vec3 = glGetUniformLocation(program, "SUN_DIRECTION");
+	SUN_COLOR_vec3 = glGetUniformLocation(program, "SUN_COLOR");
+	SKY_DIRECTION_vec3 = glGetUniformLocation(program, "SKY_DIRECTION");
+	SKY_COLOR_vec3 = glGetUniformLocation(program, "SKY_COLOR");
 
-	sun_direction_vec3 = glGetUniformLocation(program, "sun_direction");
-	sun_color_vec3 = glGetUniformLocation(program, "sun_color");
-	sky_direction_vec3 = glGetUniformLocation(program, "sky_direction");
-	sky_color_vec3 = glGetUniformLocation(program, "sky_color");
+	//set BONES to always refer to texture binding zero:
+	GLState::use_program(program); //bind program -- glUniform* calls refer to this program now
+
+	glUniform1i(BONES_samplerBuffer, 0); //set BONES to sample from GL_TEXTURE0
+
+	//default lighting (overhead sky, sun from above -- callers may set their own):
+	glUniform3fv(SUN_DIRECTION_vec3, 1, glm::value_ptr(glm::normalize(glm::vec3(-0.2f, 0.2f, 1.0f))));
+	glUniform3fv(SUN_COLOR_vec3, 1, glm::value_ptr(glm::vec3(1.0f, 1.0f, 0.95f)));
+	glUniform3fv(SKY_DIRECTION_vec3, 1, glm::value_ptr(glm::vec3(0.0f, 0.0f, 1.0f)));
+	glUniform3fv(SKY_COLOR_vec3, 1, glm::value_ptr(glm::vec3(0.2f)));
+
+	GLState::use_program(0); //unbind program -- glUniform* calls refer to ??? now
 }
 
-Load< BoneVertexColorProgram > bone_vertex_color_program(LoadTagInit, [](){
-	return new BoneVertexColorProgram();
-});
\ No newline at end of file
+BoneVertexColorProgram::~BoneVertexColorProgram() {
+	GLState::delete_program(program);
+	program = 0;
+}
+
+//------------------------------------------------
+
+BonePalette::BonePalette() {
+	GLint max_texels = 0;
+	glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &max_texels);
+	max_bones = uint32_t(max_texels) / 3;
+
+	glGenBuffers(1, &buffer);
+	glGenTextures(1, &texture);
+
+	//texture buffers need storage before they can be attached, so start with one (identity) bone:
+	rows.assign({ glm::vec4(1.0f, 0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 1.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 1.0f, 0.0f) });
+	upload();
+	rows.clear();
+
+	GLState::bind_texture(GL_TEXTURE_BUFFER, texture);
+	glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+	GLState::bind_texture(GL_TEXTURE_BUFFER, 0);
+
+	GL_ERRORS();
+}
+
+BonePalette::~BonePalette() {
+	GLState::delete_textures(1, &texture);
+	texture = 0;
+	GLState::delete_buffers(1, &buffer);
+	buffer = 0;
+}
+
+void BonePalette::clear() {
+	rows.clear();
+}
+
+uint32_t BonePalette::add(glm::mat4x3 const *bones, uint32_t count) {
+	uint32_t first = uint32_t(rows.size() / 3);
+	if (first + count > max_bones) {
+		throw std::runtime_error("BonePalette::add: " + std::to_string(first + count) + " bones is more than the texture buffer limit of " + std::to_string(max_bones) + ".");
+	}
+	rows.reserve(rows.size() + 3 * count);
+	for (uint32_t b = 0; b < count; ++b) {
+		glm::mat4x3 const &m = bones[b];
+		for (uint32_t r = 0; r < 3; ++r) {
+			rows.emplace_back(m[0][r], m[1][r], m[2][r], m[3][r]);
+		}
+	}
+	return first;
+}
+
+void BonePalette::upload() {
+	if (rows.empty()) return;
+	GLState::bind_buffer(GL_TEXTURE_BUFFER, buffer);
+	//orphan the old storage so the GPU can keep reading last frame's bones while we write these:
+	glBufferData(GL_TEXTURE_BUFFER, rows.size() * sizeof(glm::vec4), nullptr, GL_STREAM_DRAW);
+	glBufferSubData(GL_TEXTURE_BUFFER, 0, rows.size() * sizeof(glm::vec4), rows.data());
+	GLState::bind_buffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void draw_skinned_instances(GLuint vao, GLuint start, GLuint count, BonePalette const &palette, uint32_t bone_base, uint32_t bone_count, uint32_t instances, glm::mat4 const &clip_from_world) {
+	if (instances == 0 || count == 0) return;
+
+	BoneVertexColorProgram const &program = *bone_vertex_color_program;
+	GLState::use_program(program.program);
+	glUniformMatrix4fv(program.CLIP_FROM_WORLD_mat4, 1, GL_FALSE, glm::value_ptr(clip_from_world));
+	glUniform1i(program.BONE_BASE_int, GLint(bone_base));
+	glUniform1i(program.BONE_COUNT_int, GLint(bone_count));
+
+	GLState::active_texture(GL_TEXTURE0);
+	GLState::bind_texture(GL_TEXTURE_BUFFER, palette.texture);
+
+	GLState::bind_vertex_array(vao);
+	glDrawArraysInstanced(GL_TRIANGLES, GLint(start), GLsizei(count), GLsizei(instances));
+
+	GL_ERRORS();
+}
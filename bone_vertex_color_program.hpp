@@ -1,23 +1,61 @@
+#pragma once
+
 #include "GL.hpp"
 #include "Load.hpp"
 
-#define BONE_LIMIT 40
+#include <glm/glm.hpp>
+
+#include <vector>
 
+//Shader program that draws skinned, vertex-colored meshes, many instances per draw:
+// bone matrices for every instance come from one texture buffer (a BonePalette), so rig size
+// and instance count are only limited by the buffer size.
+// Instance i of a draw uses bones [BONE_BASE + i * BONE_COUNT, BONE_BASE + (i+1) * BONE_COUNT).
+// Palette matrices take the bind pose to world space, so there's no per-instance object matrix.
 struct BoneVertexColorProgram {
 	//opengl program object:
 	GLuint program = 0;
 
 	//uniform locations:
-	GLuint object_to_clip_mat4 = -1U;
-	GLuint object_to_light_mat4x3 = -1U;
-	GLuint normal_to_light_mat3 = -1U;
-	GLuint bones_mat4x3_array = -1U;
-	GLuint sun_direction_vec3 = -1U;
-	GLuint sun_color_vec3 = -1U;
-	GLuint sky_direction_vec3 = -1U;
-	GLuint sky_color_vec3 = -1U;
+	GLuint CLIP_FROM_WORLD_mat4 = -1U;
+	GLuint BONES_samplerBuffer = -1U;
+	GLuint BONE_BASE_int = -1U;
+	GLuint BONE_COUNT_int = -1U;
+	GLuint SUN_DIRECTION_vec3 = -1U;
+	GLuint SUN_COLOR_vec3 = -1U;
+	GLuint SKY_DIRECTION_vec3 = -1U;
+	GLuint SKY_COLOR_vec3 = -1U;
+
+	//Textures:
+	//TEXTURE0 - BONES (GL_TEXTURE_BUFFER)
 
 	BoneVertexColorProgram();
+	~BoneVertexColorProgram();
+};
+
+extern Load< BoneVertexColorProgram > bone_vertex_color_program;
+
+//All of a frame's bone matrices, in one texture buffer:
+// each bone is three RGBA32F texels (the rows of a world_from_bind mat4x3).
+struct BonePalette {
+	BonePalette();
+	~BonePalette();
+
+	//start a new frame's worth of bones:
+	void clear();
+	//append 'count' bones; returns the index of the first (pass as BONE_BASE):
+	// throws if the palette would exceed the texture buffer size limit
+	uint32_t add(glm::mat4x3 const *bones, uint32_t count);
+	//send the bones added since clear() to the GPU:
+	void upload();
+
+	std::vector< glm::vec4 > rows; //three per bone
+	uint32_t max_bones = 0; //GL_MAX_TEXTURE_BUFFER_SIZE / 3
+
+	GLuint buffer = 0;
+	GLuint texture = 0; //GL_TEXTURE_BUFFER view of 'buffer'
 };
 
-extern Load< BoneVertexColorProgram > bone_vertex_color_program;
\ No newline at end of file
+//draw 'instances' copies of mesh vertices [start, start+count) from 'vao' (made with make_vao_for_program(bone_vertex_color_program->program)),
+// instance i skinned by palette bones [bone_base + i * bone_count, ...):
+void draw_skinned_instances(GLuint vao, GLuint start, GLuint count, BonePalette const &palette, uint32_t bone_base, uint32_t bone_count, uint32_t instances, glm::mat4 const &clip_from_world);
@@ -1,10 +1,167 @@
 #include "gl_compile_program.hpp"
 
+#include "read_write_chunk.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <vector>
 #include <string>
 #include <stdexcept>
 #include <iostream>
 
+//program binaries are GL 4.1 (or ARB_get_program_binary), so aren't in GL.hpp's 3.3 core set;
+// they're looked up at runtime by gl_program_cache_init:
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+
+namespace {
+	typedef void (APIENTRY *GetProgramBinaryProc)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+	typedef void (APIENTRY *ProgramBinaryProc)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+	typedef void (APIENTRY *ProgramParameteriProc)(GLuint program, GLenum pname, GLint value);
+
+	struct ProgramCache {
+		bool enabled = false;
+		std::string directory; //(with trailing separator)
+		std::string driver; //vendor + renderer + version, part of every key
+		GetProgramBinaryProc GetProgramBinary = nullptr;
+		ProgramBinaryProc ProgramBinary = nullptr;
+		ProgramParameteriProc ProgramParameteri = nullptr;
+	};
+
+	ProgramCache &get_cache() {
+		static ProgramCache cache;
+		return cache;
+	}
+
+	//64-bit FNV-1a:
+	uint64_t hash_string(std::string const &str, uint64_t hash = 0xcbf29ce484222325ULL) {
+		for (char c : str) {
+			hash ^= uint8_t(c);
+			hash *= 0x100000001b3ULL;
+		}
+		return hash;
+	}
+
+	std::string gl_string(GLenum name) {
+		GLubyte const *str = glGetString(name);
+		return str ? reinterpret_cast< char const * >(str) : "";
+	}
+
+	//a linked program, or 0 if the file is missing, was saved for a different 'key' (a hash collision or stale file), or the driver rejects it:
+	GLuint load_cached_program(std::string const &path, std::string const &key) {
+		ProgramCache &cache = get_cache();
+		std::ifstream file(path, std::ios::binary);
+		if (!file) return 0;
+
+		std::vector< char > saved_key;
+		std::vector< uint32_t > format;
+		std::vector< char > binary;
+		try {
+			read_chunk(file, "pkey", &saved_key);
+			read_chunk(file, "pfmt", &format);
+			read_chunk(file, "pbin", &binary);
+		} catch (std::exception &) {
+			return 0;
+		}
+		//(the file name is only a hash of the key, so check the whole thing before trusting the binary):
+		if (saved_key.size() != key.size() || !std::equal(saved_key.begin(), saved_key.end(), key.begin())) return 0;
+		if (format.size() != 1 || binary.empty()) return 0;
+
+		GLuint program = glCreateProgram();
+		cache.ProgramBinary(program, GLenum(format[0]), binary.data(), GLsizei(binary.size()));
+		GLint link_status = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+		if (link_status != GL_TRUE) {
+			//(e.g., the driver was updated without changing its version string)
+			glDeleteProgram(program);
+			return 0;
+		}
+		return program;
+	}
+
+	void save_cached_program(std::string const &path, std::string const &key, GLuint program) {
+		ProgramCache &cache = get_cache();
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0) return;
+
+		std::vector< char > binary(length);
+		GLenum format = 0;
+		GLsizei written = 0;
+		cache.GetProgramBinary(program, length, &written, &format, binary.data());
+		if (written <= 0) return;
+		binary.resize(written);
+
+		//write to a temporary file and rename, so a crash never leaves a partial entry:
+		std::string temp = path + ".tmp";
+		{
+			std::ofstream file(temp, std::ios::binary);
+			write_chunk("pkey", std::vector< char >(key.begin(), key.end()), &file);
+			write_chunk("pfmt", std::vector< uint32_t >{ uint32_t(format) }, &file);
+			write_chunk("pbin", binary, &file);
+			if (!file) return;
+		}
+		std::error_code ec;
+		std::filesystem::rename(temp, path, ec);
+		if (ec) std::filesystem::remove(temp, ec);
+	}
+}
+
+void gl_program_cache_init(std::string const &directory) {
+	ProgramCache &cache = get_cache();
+	cache.enabled = false;
+
+	//program binaries are core in 4.1+, otherwise need the extension:
+	GLint major = 0, minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	bool supported = (major > 4 || (major == 4 && minor >= 1));
+	if (!supported) {
+		GLint extensions = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+		for (GLint i = 0; i < extensions; ++i) {
+			GLubyte const *extension = glGetStringi(GL_EXTENSIONS, GLuint(i));
+			if (extension && std::strcmp(reinterpret_cast< char const * >(extension), "GL_ARB_get_program_binary") == 0) {
+				supported = true;
+				break;
+			}
+		}
+	}
+	GLint formats = 0;
+	if (supported) glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if (!supported || formats <= 0) {
+		std::cout << "NOTE: driver can't save program binaries; shaders will be compiled every run." << std::endl;
+		return;
+	}
+
+	cache.GetProgramBinary = (GetProgramBinaryProc)SDL_GL_GetProcAddress("glGetProgramBinary");
+	cache.ProgramBinary = (ProgramBinaryProc)SDL_GL_GetProcAddress("glProgramBinary");
+	cache.ProgramParameteri = (ProgramParameteriProc)SDL_GL_GetProcAddress("glProgramParameteri");
+	if (!cache.GetProgramBinary || !cache.ProgramBinary || !cache.ProgramParameteri) {
+		std::cout << "NOTE: couldn't look up program binary functions; shaders will be compiled every run." << std::endl;
+		return;
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(directory, ec);
+	if (ec) {
+		std::cout << "NOTE: couldn't create program cache directory '" << directory << "' (" << ec.message() << "); shaders will be compiled every run." << std::endl;
+		return;
+	}
+
+	cache.directory = (std::filesystem::path(directory) / "").string();
+	cache.driver = gl_string(GL_VENDOR) + '\n' + gl_string(GL_RENDERER) + '\n' + gl_string(GL_VERSION);
+	cache.enabled = true;
+}
+
 static GLuint gl_compile_shader(GLenum type, std::string const &source) {
 	GLuint shader = glCreateShader(type);
 	GLchar const *str = source.c_str();
@@ -27,7 +184,7 @@ static GLuint gl_compile_shader(GLenum type, std::string const &source) {
 	return shader;
 }
 
-GLuint gl_compile_program(
+static GLuint gl_link_program(
 	std::string const &vertex_shader_source,
 	std::string const &fragment_shader_source
 	) {
@@ -43,6 +200,11 @@ GLuint gl_compile_program(
 	glDeleteShader(vertex_shader);
 	glDeleteShader(fragment_shader);
 
+	//ask to be able to read the linked program back (for the cache):
+	if (get_cache().enabled) {
+		get_cache().ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
 	//link the shader program and throw errors if linking fails:
 	glLinkProgram(program);
 	GLint link_status = GL_FALSE;
@@ -60,3 +222,33 @@ GLuint gl_compile_program(
 
 	return program;
 }
+
+GLuint gl_compile_program(
+	std::string const &vertex_shader_source,
+	std::string const &fragment_shader_source,
+	std::string const &name
+	) {
+	ProgramCache &cache = get_cache();
+	if (!cache.enabled) return gl_link_program(vertex_shader_source, fragment_shader_source);
+
+	auto before = std::chrono::high_resolution_clock::now();
+
+	//key is the sources plus the driver, so a driver update is just a cache miss:
+	// (files are named by the key's hash, and store the key itself to check against when loading)
+	std::string key = cache.driver + '\0' + vertex_shader_source + '\0' + fragment_shader_source;
+	std::ostringstream path;
+	path << cache.directory << std::hex << std::setw(16) << std::setfill('0') << hash_string(key) << ".program";
+
+	GLuint program = load_cached_program(path.str(), key);
+	bool hit = (program != 0);
+	if (!hit) {
+		program = gl_link_program(vertex_shader_source, fragment_shader_source);
+		save_cached_program(path.str(), key, program);
+	}
+
+	auto after = std::chrono::high_resolution_clock::now();
+	double ms = std::chrono::duration< double, std::milli >(after - before).count();
+	std::cout << "Program '" << name << "': " << (hit ? "cache hit" : "compiled") << " in " << std::fixed << std::setprecision(2) << ms << " ms." << std::defaultfloat << std::endl;
+
+	return program;
+}
@@ -6,6 +6,15 @@
 
 //compiles+links an OpenGL shader program from source.
 // throws on compilation error.
+// 'name' is only used in log messages.
+//If gl_program_cache_init() has been called, linked programs are cached on disk and
+// reloaded (skipping compilation) on later runs with the same sources and driver.
 GLuint gl_compile_program(
 	std::string const &vertex_shader_source,
-	std::string const &fragment_shader_source);
+	std::string const &fragment_shader_source,
+	std::string const &name = "program");
+
+//turn on the program binary cache, storing files in 'directory' (created if needed):
+// call after creating the GL context; does nothing if the driver can't return program binaries.
+// each gl_compile_program call afterward logs whether it was a cache hit and how long it took.
+void gl_program_cache_init(std::string const &directory);
@@ -10,11 +10,29 @@
 // For sound init:
 #include "Sound.hpp"
 
+// for asynchronous image decoding + texture upload:
+#include "AsyncImage.hpp"
+
+// for parallel gameplay updates:
+#include "JobSystem.hpp"
+
 // GL.hpp will include a non-namespace-polluting set of opengl prototypes:
 #include "GL.hpp"
 
 // for screenshots:
-#include "load_save_png.hpp"
+#include "ScreenCapture.hpp"
+
+// for frame timing:
+#include "Profiler.hpp"
+
+// for the shader program binary cache:
+#include "gl_compile_program.hpp"
+
+// for per-frame GL state call counts:
+#include "GLState.hpp"
+
+// for drawing on a separate thread (--render-thread):
+#include "RenderThread.hpp"
 
 // Includes for libSDL:
 #include <SDL3/SDL.h>
@@ -25,7 +43,12 @@
 #include <iostream>
 #include <stdexcept>
 #include <memory>
+#include <functional>
 #include <algorithm>
+#include <cmath>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
 
 #ifdef _WIN32
 extern "C"
@@ -56,6 +79,64 @@ int main(int argc, char **argv)
 
 		//------------  initialization ------------
 
+		// Simulation runs at a fixed rate, independent of the display's refresh rate:
+		float simulation_hz = 120.0f;
+		// ...but if a frame takes long enough to need more than this many steps, simulation slows down:
+		uint32_t max_catch_up_steps = 8;
+		// Drawing can happen on its own thread, overlapping the next frame's updates (see RenderThread.hpp):
+		bool render_thread = false;
+
+		// numeric arguments must be entirely a number (anything else gets the usage message below):
+		auto parse_float = [](char const *str, float *out)
+		{
+			char *end = nullptr;
+			errno = 0;
+			float value = std::strtof(str, &end);
+			if (end == str || *end != '\0' || errno == ERANGE)
+				return false;
+			*out = value;
+			return true;
+		};
+		auto parse_uint = [](char const *str, uint32_t *out)
+		{
+			if (!std::isdigit(uint8_t(str[0])))
+				return false; //(strtoul would accept "-1")
+			char *end = nullptr;
+			errno = 0;
+			unsigned long value = std::strtoul(str, &end, 10);
+			if (*end != '\0' || errno == ERANGE || value > 0xffffffffUL)
+				return false;
+			*out = uint32_t(value);
+			return true;
+		};
+
+		for (int argi = 1; argi < argc; ++argi)
+		{
+			std::string arg = argv[argi];
+			if (arg == "--sim-hz" && argi + 1 < argc && parse_float(argv[argi + 1], &simulation_hz))
+			{
+				argi += 1;
+			}
+			else if (arg == "--max-catch-up" && argi + 1 < argc && parse_uint(argv[argi + 1], &max_catch_up_steps))
+			{
+				argi += 1;
+			}
+			else if (arg == "--render-thread")
+			{
+				render_thread = true;
+			}
+			else
+			{
+				std::cerr << "Usage:\n\t" << argv[0] << " [--sim-hz <steps per second>] [--max-catch-up <steps>] [--render-thread]" << std::endl;
+				return 1;
+			}
+		}
+		if (!(simulation_hz > 0.0f) || max_catch_up_steps == 0)
+		{
+			throw std::runtime_error("--sim-hz and --max-catch-up must be positive.");
+		}
+		float const simulation_step = 1.0f / simulation_hz;
+
 		// Initialize SDL library:
 		SDL_Init(SDL_INIT_VIDEO);
 
@@ -113,6 +194,17 @@ int main(int argc, char **argv)
 			}
 		}
 
+		// Cache linked shader programs between runs (in the per-user data directory):
+		if (char *pref_path = SDL_GetPrefPath("", "cheese-on-a-roll"))
+		{
+			gl_program_cache_init(std::string(pref_path) + "program-cache");
+			SDL_free(pref_path);
+		}
+		else
+		{
+			std::cerr << "NOTE: no per-user data directory (" << SDL_GetError() << "); shaders will be compiled every run." << std::endl;
+		}
+
 		// Set automatic SRGB encoding if framebuffer needs it:
 		glEnable(GL_FRAMEBUFFER_SRGB);
 
@@ -122,12 +214,28 @@ int main(int argc, char **argv)
 		//------------ init sound --------------
 		Sound::init();
 
+		//------------ init image loader --------------
+		AsyncImage::init();
+
+		//------------ init job system --------------
+		JobSystem::init();
+
+		//------------ init screen capture --------------
+		ScreenCapture::init();
+
 		//------------ load assets --------------
 		call_load_functions();
 
 		//------------ create game mode + make current --------------
 		Mode::set_current(std::make_shared<PlayMode>());
 
+		//------------ hand the GL context to the render thread --------------
+		// (from here on, GL calls from this thread go through RenderThread::run_on_gl_thread)
+		if (render_thread)
+		{
+			RenderThread::start(Mode::window, context);
+		}
+
 		//------------ main loop ------------
 
 		// this inline function will be called whenever the window is resized,
@@ -142,10 +250,14 @@ int main(int argc, char **argv)
 			window_size = glm::uvec2(w, h);
 			SDL_GetWindowSizeInPixels(Mode::window, &w, &h);
 			drawable_size = glm::uvec2(w, h);
-			glViewport(0, 0, drawable_size.x, drawable_size.y);
+			RenderThread::run_on_gl_thread([size = drawable_size]()
+										   { glViewport(0, 0, size.x, size.y); });
 		};
 		on_resize();
 
+		// (profiler frames run from one swap to the next; see the end of step (3))
+		RenderThread::run_on_gl_thread(Profiler::begin_frame);
+
 		// This will loop until the current mode is set to null:
 		while (Mode::current)
 		{
@@ -153,6 +265,7 @@ int main(int argc, char **argv)
 			//   by performing three steps:
 
 			{ //(1) process any events that are pending
+				PROFILE_SCOPE("events");
 				static SDL_Event evt;
 				while (SDL_PollEvent(&evt))
 				{
@@ -166,64 +279,159 @@ int main(int argc, char **argv)
 					{
 						// mode handled it; great
 					}
+					// (modes, screen capture, and the profiler's frame data are used while drawing, so the
+					//  handlers below change them on the GL thread -- which is this thread unless --render-thread)
 					else if (evt.type == SDL_EVENT_QUIT)
 					{
-						Mode::set_current(nullptr);
+						RenderThread::run_on_gl_thread([]()
+													   { Mode::set_current(nullptr); });
 						break;
 					}
 					else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_PRINTSCREEN)
 					{
-						// --- screenshot key ---
-						std::string filename = "screenshot.png";
-						std::cout << "Saving screenshot to '" << filename << "'." << std::endl;
-						glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
-						glReadBuffer(GL_FRONT);
-						int w, h;
-						SDL_GetWindowSizeInPixels(Mode::window, &w, &h);
-						std::vector<glm::u8vec4> data(w * h);
-						glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
-						for (auto &px : data)
-						{
-							px.a = 0xff;
-						}
-						save_png(filename, glm::uvec2(w, h), data.data(), LowerLeftOrigin);
+						// --- screenshot key (saved once the frame has been read back) ---
+						RenderThread::run_on_gl_thread([]()
+													   { ScreenCapture::request_screenshot("screenshot.png"); });
+					}
+					else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_F12)
+					{
+						// --- frame dump key (toggles saving every frame) ---
+						RenderThread::run_on_gl_thread([]()
+													   {
+							if (ScreenCapture::recording())
+							{
+								ScreenCapture::stop_recording();
+								std::cout << "Stopped recording frames." << std::endl;
+							}
+							else
+							{
+								ScreenCapture::start_recording("frames/frame-");
+								std::cout << "Recording frames to 'frames/'." << std::endl;
+							} });
+					}
+					else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_F3)
+					{
+						// --- profiler overlay key ---
+						RenderThread::run_on_gl_thread([]()
+													   { Profiler::overlay_visible = !Profiler::overlay_visible; });
+					}
+					else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_F4)
+					{
+						// --- profile export key ---
+						RenderThread::run_on_gl_thread([]()
+													   {
+							Profiler::export_csv("profile.csv");
+							Profiler::export_trace("profile.json"); });
 					}
 					else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_R)
 					{
 						Sound::stop_all_samples();
-						Mode::set_current(std::make_shared<PlayMode>());
+						RenderThread::run_on_gl_thread([]()
+													   { Mode::set_current(std::make_shared<PlayMode>()); });
 					}
 				}
 				if (!Mode::current)
 					break;
 			}
 
-			{ //(2) call the current mode's "update" function to deal with elapsed time:
+			{ //(2) call the current mode's "update" function in fixed steps to consume elapsed time:
 				auto current_time = std::chrono::high_resolution_clock::now();
 				static auto previous_time = current_time;
 				float elapsed = std::chrono::duration<float>(current_time - previous_time).count();
 				previous_time = current_time;
 
-				// if frames are taking a very long time to process,
-				// lag to avoid spiral of death:
-				elapsed = std::min(0.1f, elapsed);
+				static float accumulator = 0.0f;
+				accumulator += elapsed;
 
-				Mode::current->update(elapsed);
+				{
+					PROFILE_SCOPE("update");
+					uint32_t steps = 0;
+					while (accumulator >= simulation_step && steps < max_catch_up_steps && Mode::current)
+					{
+						Mode::current->update(simulation_step);
+						accumulator -= simulation_step;
+						steps += 1;
+					}
+				}
 				if (!Mode::current)
 					break;
+
+				// if frames are taking a very long time to process,
+				// drop the time that couldn't be simulated to avoid spiral of death:
+				if (accumulator >= simulation_step)
+				{
+					accumulator = std::fmod(accumulator, simulation_step);
+				}
+
+				// let the mode know how far it is between its last update and the next one:
+				Mode::current->interpolate(accumulator / simulation_step);
 			}
 
 			{ //(3) call the current mode's "draw" function to produce output:
+				// with a render thread, the mode records what to draw here, and the render thread
+				//  draws and shows it while this thread goes on to the next frame's events + updates
+				std::function<void()> draw;
+				if (RenderThread::running())
+				{
+					PROFILE_SCOPE("record");
+					draw = Mode::current->record(drawable_size);
+				}
+				// (modes that don't record are drawn directly; the main thread waits for them)
+				bool wait = !draw;
+				if (!draw)
+				{
+					draw = [mode = Mode::current.get(), drawable_size]()
+					{
+						mode->draw(drawable_size);
+					};
+				}
 
-				Mode::current->draw(drawable_size);
-			}
+				// (the frame holds a reference to the mode, so a mode switch can't destroy it mid-draw)
+				RenderThread::submit_frame([draw = std::move(draw), mode = Mode::current, drawable_size]()
+										   {
+					// upload any images that finished decoding since last frame:
+					{
+						PROFILE_SCOPE("AsyncImage::update");
+						AsyncImage::update();
+					}
+
+					{
+						PROFILE_SCOPE("draw");
+						draw();
+					}
 
-			// Wait until the recently-drawn frame is shown before doing it all again:
-			SDL_GL_SwapWindow(Mode::window);
+					// read back the frame (if a screenshot or recording wants it) without stalling:
+					{
+						PROFILE_SCOPE("ScreenCapture::capture");
+						ScreenCapture::capture(drawable_size);
+					}
+
+					// (after capture, so the overlay doesn't show up in screenshots)
+					Profiler::draw_overlay(drawable_size);
+
+					// Wait until the recently-drawn frame is shown before doing it all again:
+					{
+						PROFILE_SCOPE("swap");
+						SDL_GL_SwapWindow(Mode::window);
+					}
+					GLState::end_frame();
+					Profiler::end_frame();
+					Profiler::begin_frame(); });
+				if (wait)
+				{
+					RenderThread::wait_idle();
+				}
+			}
 		}
 
 		//------------  teardown ------------
+		// (finish drawing and take the GL context back, so everything below runs on this thread)
+		RenderThread::stop();
 		Sound::shutdown();
+		AsyncImage::shutdown();
+		ScreenCapture::shutdown();
+		Profiler::shutdown();
+		JobSystem::shutdown();
 
 		SDL_GL_DestroyContext(context);
 		context = 0;
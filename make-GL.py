@@ -8,6 +8,7 @@ import re
 filtered = []
 lookups = []
 fps = []
+functions = [] #(return type, name, argument list) of every function, for GL_PROFILE wrappers
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -76,6 +77,8 @@ with open('glcorearb.h', 'r') as f:
 			#check for function prototype lines:
 			m = re.match(r"GLAPI(.*)APIENTRY ([^\s]+) (.*)$", line)
 			if m != None:
+				if mode != "skip":
+					functions.append((m.group(1).strip(), m.group(2), m.group(3).rstrip(";").strip()))
 				if mode == "all_proto":
 					filtered.append(line)
 				elif mode == "win_pointer":
@@ -103,6 +106,40 @@ with open('glcorearb.h', 'r') as f:
 			print("ignoring: " + line)
 
 
+#---------------- GL_PROFILE wrappers ----------------
+
+#names of the arguments in an argument list like "(GLuint shader, const GLchar *const*string)":
+def argument_names(args):
+	inner = args[1:-1].strip()
+	if inner == "" or inner == "void":
+		return []
+	return [ re.search(r"(\w+)\s*$", arg).group(1) for arg in inner.split(",") ]
+
+#bytes of data uploaded by a call (as an expression in the call's arguments):
+upload_bytes = {
+	"glBufferData": "(data ? uint64_t(size) : 0)",
+	"glBufferSubData": "(data ? uint64_t(size) : 0)",
+	"glTexImage2D": "(pixels ? pixel_bytes(format, type, width, height, 1) : 0)",
+	"glTexSubImage2D": "(pixels ? pixel_bytes(format, type, width, height, 1) : 0)",
+	"glTexImage3D": "(pixels ? pixel_bytes(format, type, width, height, depth) : 0)",
+	"glTexSubImage3D": "(pixels ? pixel_bytes(format, type, width, height, depth) : 0)",
+}
+
+def wrapper_signature(rt, fn, ag):
+	return rt + ("" if rt.endswith("*") else " ") + "gl_profile_" + fn + ag
+
+profile_declarations = []
+profile_redirects = []
+profile_entries = []
+profile_wrappers = []
+for (index, (rt, fn, ag)) in enumerate(functions):
+	profile_declarations.append(wrapper_signature(rt, fn, ag) + ";")
+	profile_redirects.append("#define " + fn + " gl_profile_" + fn)
+	profile_entries.append("{ \"" + fn + "\", 0, 0, 0 },")
+	timed = "Timed timed(entries[" + str(index) + "]" + (", " + upload_bytes[fn] if fn in upload_bytes else "") + ");"
+	call = fn + "(" + ", ".join(argument_names(ag)) + ");"
+	profile_wrappers.append(wrapper_signature(rt, fn, ag) + " {\n\t" + timed + "\n\t" + ("" if rt == "void" else "return ") + call + "\n}")
+
 
 with open("GL.hpp", "w") as f:
 	print("""#pragma once
@@ -151,11 +188,40 @@ typedef signed   long  int     khronos_ssize_t;
 	print("\n".join(filtered), file=f)
 
 	print("""
-}""", file=f)
+}
+
+//Optional call instrumentation: when GL_PROFILE is defined, every gl* function above
+// is redirected to a wrapper that counts calls, CPU time, and bytes uploaded per entry point.
+//(Uploads sourced from a bound GL_PIXEL_UNPACK_BUFFER -- a null 'pixels' offset -- aren't counted.)
+#ifdef GL_PROFILE
+
+#include <stddef.h>
+
+struct GLProfileEntry {
+	char const *name;
+	uint64_t calls;
+	uint64_t bytes; //data uploaded by glBufferData, glBufferSubData, glTex[Sub]Image2D/3D
+	uint64_t nanoseconds; //CPU time spent in the call
+};
+
+//per-entry-point totals since the last gl_profile_reset() (GL thread only):
+GLProfileEntry *gl_profile_entries(size_t *count);
+void gl_profile_reset();
+""", file=f)
+	print("\n".join(profile_declarations), file=f)
+	print("""
+//(GL.cpp defines GL_PROFILE_NO_REDIRECT so that it can call the real functions)
+#ifndef GL_PROFILE_NO_REDIRECT""", file=f)
+	print("\n".join(profile_redirects), file=f)
+	print("""#endif
+
+#endif""", file=f)
 
 
 with open("GL.cpp", "w") as f:
-	print("""#include "GL.hpp"
+	print("""//init_GL and the GL_PROFILE wrappers call the real functions:
+#define GL_PROFILE_NO_REDIRECT
+#include "GL.hpp"
 
 #include <SDL3/SDL.h>
 #include <iostream>
@@ -176,4 +242,83 @@ void init_GL() {""", file=f)
 	print("""}
 #ifdef _WIN32""", file=f)
 	print("\t" + "\n\t".join(fps),file=f)
-	print("""#endif""", file=f)
+	print("""#endif
+
+#ifdef GL_PROFILE
+#include <chrono>
+
+namespace {
+	GLProfileEntry entries[] = {""", file=f)
+	print("\t\t" + "\n\t\t".join(profile_entries), file=f)
+	print("""	};
+
+	//counts a call (and the time until the end of the enclosing block):
+	struct Timed {
+		Timed(GLProfileEntry &entry_, uint64_t bytes = 0) : entry(entry_), start(std::chrono::steady_clock::now()) {
+			entry.bytes += bytes;
+		}
+		~Timed() {
+			entry.calls += 1;
+			entry.nanoseconds += uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+		}
+		GLProfileEntry &entry;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	//size of a block of client-memory pixels (ignoring GL_UNPACK_ROW_LENGTH / GL_UNPACK_ALIGNMENT padding):
+	uint64_t pixel_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth) {
+		uint64_t pixels = uint64_t(width) * uint64_t(height) * uint64_t(depth);
+		switch (type) {
+			case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+				return pixels;
+			case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+			case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+			case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+				return pixels * 2;
+			case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+			case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+			case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+				return pixels * 4;
+			case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+				return pixels * 8;
+			default: break;
+		}
+		uint64_t components = 4;
+		switch (format) {
+			case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER: case GL_GREEN_INTEGER: case GL_BLUE_INTEGER:
+			case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+				components = 1; break;
+			case GL_RG: case GL_RG_INTEGER:
+				components = 2; break;
+			case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+				components = 3; break;
+			default: break;
+		}
+		uint64_t component_bytes = 1;
+		switch (type) {
+			case GL_SHORT: case GL_UNSIGNED_SHORT: case GL_HALF_FLOAT:
+				component_bytes = 2; break;
+			case GL_INT: case GL_UNSIGNED_INT: case GL_FLOAT:
+				component_bytes = 4; break;
+			default: break;
+		}
+		return pixels * components * component_bytes;
+	}
+}
+
+GLProfileEntry *gl_profile_entries(size_t *count) {
+	*count = sizeof(entries) / sizeof(entries[0]);
+	return entries;
+}
+
+void gl_profile_reset() {
+	for (auto &entry : entries) {
+		entry.calls = 0;
+		entry.bytes = 0;
+		entry.nanoseconds = 0;
+	}
+}
+""", file=f)
+	print("\n\n".join(profile_wrappers), file=f)
+	print("""
+#endif""", file=f)
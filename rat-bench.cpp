@@ -0,0 +1,145 @@
+//Benchmark for RatSystem::update: runs a synthetic level with 10 .. 10,000 rats
+// at several thread counts, and reports time per update and speedup over one thread.
+//
+//Usage:
+//  rat-bench [--steps N] [--max-threads T]
+//
+//Doesn't open a window (or touch OpenGL); the level is a long floor with
+// steps and thin platforms, roughly the density of the shipped levels.
+
+#include "Rat.hpp"
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <thread>
+
+struct Level {
+	std::list< Scene::Transform > transforms; //(list so pointers stay valid)
+	std::vector< Scene::Transform * > platforms;
+	std::vector< Scene::Transform * > rats;
+
+	Scene::Transform *add(std::vector< Scene::Transform * > *into, glm::vec3 const &position, glm::vec3 const &scale) {
+		transforms.emplace_back();
+		transforms.back().position = position;
+		transforms.back().scale = scale;
+		into->emplace_back(&transforms.back());
+		return &transforms.back();
+	}
+};
+
+static void make_level(Level *level_, uint32_t rat_count) {
+	Level &level = *level_;
+	//level length grows with the rat count, so rat density stays about the same:
+	float length = std::max(400.0f, float(rat_count) * 4.0f);
+
+	//floor segments:
+	for (float y = 0.0f; y < length; y += 40.0f) {
+		level.add(&level.platforms, glm::vec3(0.0f, y + 20.0f, -1.0f), glm::vec3(1.0f, 20.0f, 1.0f));
+	}
+	//thin platforms and steps:
+	for (float y = 10.0f; y < length; y += 25.0f) {
+		float z = 6.0f + 4.0f * float(int(y) % 3);
+		level.add(&level.platforms, glm::vec3(0.0f, y, z), glm::vec3(1.0f, 4.0f, 0.2f));
+	}
+	//rats, spread along the level and dropped from a little above the floor:
+	for (uint32_t i = 0; i < rat_count; ++i) {
+		float y = length * (float(i) + 0.5f) / float(rat_count);
+		level.add(&level.rats, glm::vec3(0.0f, y, 2.0f + float(i % 7)), glm::vec3(1.0f, 1.0f, 1.0f));
+	}
+}
+
+//run 'steps' updates of a fresh level; returns seconds spent in RatSystem::update and a checksum of the final state:
+static std::pair< double, double > run(uint32_t rat_count, uint32_t steps) {
+	Level level;
+	make_level(&level, rat_count);
+
+	RatSystem rats;
+	for (auto *rat : level.rats) rats.add(rat);
+	rats.set_solids({&level.platforms});
+
+	float const step = 1.0f / 120.0f;
+	float length = std::max(400.0f, float(rat_count) * 4.0f);
+
+	double seconds = 0.0;
+	for (uint32_t s = 0; s < steps; ++s) {
+		//player sweeps back and forth along the level so rats keep switching aggro:
+		float t = float(s) / float(steps);
+		glm::vec3 player = glm::vec3(0.0f, length * (0.5f + 0.5f * std::sin(t * 6.2831853f)), 1.0f);
+
+		auto before = std::chrono::high_resolution_clock::now();
+		rats.update(step, player);
+		auto after = std::chrono::high_resolution_clock::now();
+		seconds += std::chrono::duration< double >(after - before).count();
+	}
+
+	double checksum = 0.0;
+	for (size_t i = 0; i < rats.size(); ++i) {
+		checksum += double(rats.position_y[i]) * double(i + 1) + double(rats.position_z[i]);
+	}
+	return std::make_pair(seconds, checksum);
+}
+
+int main(int argc, char **argv) {
+	uint32_t steps = 240;
+	uint32_t max_threads = std::max(1U, std::thread::hardware_concurrency());
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--steps" && argi + 1 < argc) {
+			steps = uint32_t(std::stoul(argv[++argi]));
+		} else if (arg == "--max-threads" && argi + 1 < argc) {
+			max_threads = std::max(1U, uint32_t(std::stoul(argv[++argi])));
+		} else {
+			std::cerr << "Usage:\n\t" << argv[0] << " [--steps N] [--max-threads T]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector< uint32_t > thread_counts;
+	for (uint32_t t = 1; t < max_threads; t *= 2) thread_counts.emplace_back(t);
+	thread_counts.emplace_back(max_threads);
+
+	std::cout << "RatSystem::update, " << steps << " steps per run (ms per update; speedup vs. 1 thread)" << std::endl;
+	std::cout << std::setw(8) << "rats";
+	for (uint32_t t : thread_counts) std::cout << std::setw(20) << (std::to_string(t) + " thread" + (t == 1 ? "" : "s"));
+	std::cout << std::endl;
+
+	bool deterministic = true;
+	for (uint32_t rat_count : {10U, 100U, 1000U, 10000U}) {
+		std::cout << std::setw(8) << rat_count << std::flush;
+		double base = 0.0;
+		double base_checksum = 0.0;
+		for (uint32_t t : thread_counts) {
+			JobSystem::init(int32_t(t) - 1);
+			run(rat_count, std::min(steps, 10U)); //warm up
+			auto [seconds, checksum] = run(rat_count, steps);
+			JobSystem::shutdown();
+
+			double ms = 1000.0 * seconds / double(steps);
+			if (t == 1) {
+				base = ms;
+				base_checksum = checksum;
+			}
+			if (checksum != base_checksum) deterministic = false;
+
+			std::ostringstream cell;
+			cell << std::fixed << std::setprecision(3) << ms << " (" << std::setprecision(2) << base / ms << "x)";
+			std::cout << std::setw(20) << cell.str() << std::flush;
+		}
+		std::cout << std::endl;
+	}
+
+	if (!deterministic) {
+		std::cout << "WARNING: results differed between thread counts." << std::endl;
+		return 1;
+	}
+	std::cout << "Results identical across thread counts." << std::endl;
+	return 0;
+}
@@ -0,0 +1,242 @@
+//Benchmark for ray vs. box tests: casts random rays at 16 .. 4096 randomly placed,
+// rotated, and scaled boxes and reports the time per ray (closest hit) for:
+//  - world_box + ray_box_intersect (scale-only axis-aligned boxes; the old picking path)
+//  - ray_obb_intersect (exact oriented mesh-bounds box, ray moved into local space)
+//  - ray_boxes4_intersect / ray_boxes8_intersect (axis-aligned bounds of the oriented boxes, 4/8 at a time)
+//  - RayBVH::closest_hit (exact oriented boxes)
+//
+//Usage:
+//  raycast-bench [--rays N]
+//
+//Doesn't open a window (or touch OpenGL). Exits with an error if the batched tests
+// disagree with ray_box_intersect or the BVH disagrees with a linear scan.
+
+#include "RayCast.hpp"
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+struct Boxes {
+	Scene scene;
+	std::vector< Scene::Transform * > transforms;
+
+	//per-box data for the linear scans:
+	std::vector< glm::vec3 > legacy_center, legacy_half; //world_box()
+	std::vector< glm::mat4x3 > local_from_world;
+	std::vector< glm::vec3 > local_min, local_max;
+	std::vector< glm::vec3 > world_min, world_max; //bounds of the oriented boxes
+	std::vector< RayBoxes4 > packed4;
+	std::vector< RayBoxes8 > packed8;
+};
+
+static void make_boxes(Boxes *boxes_, uint32_t count, std::mt19937 &mt) {
+	Boxes &boxes = *boxes_;
+	std::uniform_real_distribution< float > position(-100.0f, 100.0f);
+	std::uniform_real_distribution< float > size(0.5f, 4.0f);
+	std::uniform_real_distribution< float > angle(-3.1415926f, 3.1415926f);
+	std::uniform_real_distribution< float > axis(-1.0f, 1.0f);
+
+	for (uint32_t i = 0; i < count; ++i) {
+		boxes.scene.transforms.emplace_back();
+		Scene::Transform &t = boxes.scene.transforms.back();
+		t.name = "Box_" + std::to_string(i);
+		t.position = glm::vec3(position(mt), position(mt), position(mt));
+		t.rotation = glm::angleAxis(angle(mt), glm::normalize(glm::vec3(axis(mt), axis(mt), axis(mt)) + glm::vec3(0.0f, 0.0f, 1e-3f)));
+		t.scale = glm::vec3(size(mt), size(mt), size(mt));
+		boxes.transforms.emplace_back(&t);
+
+		//mesh bounds that aren't the unit cube, like most real meshes:
+		boxes.scene.drawables.emplace_back(&t);
+		boxes.scene.drawables.back().min = glm::vec3(-1.0f, -0.5f, 0.0f);
+		boxes.scene.drawables.back().max = glm::vec3( 1.0f,  0.5f, 2.0f);
+	}
+	boxes.scene.build_index();
+
+	for (auto *t : boxes.transforms) {
+		glm::vec3 c, h;
+		world_box(t, c, h);
+		boxes.legacy_center.emplace_back(c);
+		boxes.legacy_half.emplace_back(h);
+
+		Scene::Drawable const *d = boxes.scene.drawable_for(t);
+		boxes.local_from_world.emplace_back(t->make_local_from_world());
+		boxes.local_min.emplace_back(d->min);
+		boxes.local_max.emplace_back(d->max);
+
+		glm::mat4x3 world_from_local = t->make_world_from_local();
+		glm::vec3 center = world_from_local * glm::vec4(0.5f * (d->min + d->max), 1.0f);
+		glm::vec3 half = 0.5f * (d->max - d->min);
+		glm::vec3 extent = glm::abs(glm::vec3(world_from_local[0])) * half.x
+		                 + glm::abs(glm::vec3(world_from_local[1])) * half.y
+		                 + glm::abs(glm::vec3(world_from_local[2])) * half.z;
+		boxes.world_min.emplace_back(center - extent);
+		boxes.world_max.emplace_back(center + extent);
+	}
+
+	//pack by component (padding with far-away boxes behind every ray origin):
+	glm::vec3 far = glm::vec3(1e6f);
+	boxes.packed4.resize((count + 3) / 4);
+	boxes.packed8.resize((count + 7) / 8);
+	for (uint32_t i = 0; i < boxes.packed4.size() * 4; ++i) {
+		bool real = (i < count);
+		boxes.packed4[i / 4].set(i % 4, real ? boxes.world_min[i] : far, real ? boxes.world_max[i] : far);
+	}
+	for (uint32_t i = 0; i < boxes.packed8.size() * 8; ++i) {
+		bool real = (i < count);
+		boxes.packed8[i / 8].set(i % 8, real ? boxes.world_min[i] : far, real ? boxes.world_max[i] : far);
+	}
+}
+
+//time 'cast' over all rays; returns nanoseconds per ray (and accumulates hit indices into 'check' so work isn't optimized away):
+template< typename F >
+static double time_rays(std::vector< Ray > const &rays, F const &cast, uint64_t *check) {
+	auto before = std::chrono::high_resolution_clock::now();
+	uint64_t sum = 0;
+	for (auto const &r : rays) sum += uint64_t(cast(r) + 1);
+	auto after = std::chrono::high_resolution_clock::now();
+	*check += sum;
+	return std::chrono::duration< double, std::nano >(after - before).count() / double(rays.size());
+}
+
+int main(int argc, char **argv) {
+	uint32_t ray_count = 100000;
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--rays" && argi + 1 < argc) {
+			ray_count = std::max(1U, uint32_t(std::stoul(argv[++argi])));
+		} else {
+			std::cerr << "Usage:\n\t" << argv[0] << " [--rays N]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::mt19937 mt(0x0ddba11);
+
+	std::vector< Ray > rays;
+	{
+		std::uniform_real_distribution< float > origin(-120.0f, 120.0f);
+		std::uniform_real_distribution< float > target(-60.0f, 60.0f);
+		for (uint32_t i = 0; i < ray_count; ++i) {
+			Ray r;
+			r.origin = glm::vec3(origin(mt), origin(mt), origin(mt));
+			r.dir = glm::normalize(glm::vec3(target(mt), target(mt), target(mt)) - r.origin + glm::vec3(1e-3f));
+			rays.emplace_back(r);
+		}
+	}
+
+	std::cout << "Closest hit, " << ray_count << " rays per run (ns per ray)" << std::endl;
+	std::cout << std::setw(8) << "boxes"
+		<< std::setw(14) << "world_box" << std::setw(14) << "obb"
+		<< std::setw(14) << "boxes4" << std::setw(14) << "boxes8"
+		<< std::setw(14) << "bvh" << std::endl;
+
+	bool agree = true;
+	uint64_t check = 0;
+	for (uint32_t count : {16U, 64U, 256U, 1024U, 4096U}) {
+		Boxes boxes;
+		make_boxes(&boxes, count, mt);
+		RayBVH bvh;
+		bvh.build(boxes.transforms, &boxes.scene);
+
+		auto legacy = [&](Ray const &r) -> int32_t {
+			int32_t best = -1;
+			float best_t = std::numeric_limits< float >::max();
+			for (uint32_t i = 0; i < count; ++i) {
+				float t;
+				if (ray_box_intersect(r, boxes.legacy_center[i], boxes.legacy_half[i], &t) && t < best_t) {
+					best_t = t;
+					best = int32_t(i);
+				}
+			}
+			return best;
+		};
+		auto obb = [&](Ray const &r) -> int32_t {
+			int32_t best = -1;
+			float best_t = std::numeric_limits< float >::max();
+			for (uint32_t i = 0; i < count; ++i) {
+				float t;
+				if (ray_obb_intersect(r, boxes.local_from_world[i], boxes.local_min[i], boxes.local_max[i], &t) && t < best_t) {
+					best_t = t;
+					best = int32_t(i);
+				}
+			}
+			return best;
+		};
+		auto aabb = [&](Ray const &r) -> int32_t { //scalar reference for the batched tests
+			int32_t best = -1;
+			float best_t = std::numeric_limits< float >::max();
+			for (uint32_t i = 0; i < count; ++i) {
+				float t;
+				if (ray_box_intersect(r, 0.5f * (boxes.world_min[i] + boxes.world_max[i]), 0.5f * (boxes.world_max[i] - boxes.world_min[i]), &t) && t < best_t) {
+					best_t = t;
+					best = int32_t(i);
+				}
+			}
+			return best;
+		};
+		auto batch4 = [&](Ray const &r) -> int32_t {
+			RaySlab slab(r);
+			int32_t best = -1;
+			float best_t = std::numeric_limits< float >::max();
+			for (uint32_t b = 0; b < boxes.packed4.size(); ++b) {
+				float t[4];
+				uint32_t mask = ray_boxes4_intersect(slab, boxes.packed4[b], best_t, t);
+				for (uint32_t k = 0; mask; ++k, mask >>= 1) {
+					if ((mask & 1) && t[k] < best_t) {
+						best_t = t[k];
+						best = int32_t(b * 4 + k);
+					}
+				}
+			}
+			return best;
+		};
+		auto batch8 = [&](Ray const &r) -> int32_t {
+			RaySlab slab(r);
+			int32_t best = -1;
+			float best_t = std::numeric_limits< float >::max();
+			for (uint32_t b = 0; b < boxes.packed8.size(); ++b) {
+				float t[8];
+				uint32_t mask = ray_boxes8_intersect(slab, boxes.packed8[b], best_t, t);
+				for (uint32_t k = 0; mask; ++k, mask >>= 1) {
+					if ((mask & 1) && t[k] < best_t) {
+						best_t = t[k];
+						best = int32_t(b * 8 + k);
+					}
+				}
+			}
+			return best;
+		};
+		auto tree = [&](Ray const &r) -> int32_t {
+			RayHit hit;
+			if (!bvh.closest_hit(r, &hit)) return -1;
+			return int32_t(bvh.item_index.at(hit.transform));
+		};
+
+		//correctness first (on a subset of the rays):
+		for (uint32_t i = 0; i < std::min(ray_count, 2000U); ++i) {
+			int32_t expect = aabb(rays[i]);
+			if (batch4(rays[i]) != expect || batch8(rays[i]) != expect) agree = false;
+			if (tree(rays[i]) != obb(rays[i])) agree = false;
+		}
+
+		std::cout << std::setw(8) << count << std::fixed << std::setprecision(1)
+			<< std::setw(14) << time_rays(rays, legacy, &check) << std::flush
+			<< std::setw(14) << time_rays(rays, obb, &check) << std::flush
+			<< std::setw(14) << time_rays(rays, batch4, &check) << std::flush
+			<< std::setw(14) << time_rays(rays, batch8, &check) << std::flush
+			<< std::setw(14) << time_rays(rays, tree, &check) << std::endl;
+	}
+	std::cout << "(checksum " << check << ")" << std::endl;
+
+	if (!agree) {
+		std::cout << "WARNING: batched or BVH results disagreed with the scalar tests." << std::endl;
+		return 1;
+	}
+	std::cout << "Batched and BVH results match the scalar tests." << std::endl;
+	return 0;
+}
@@ -0,0 +1,367 @@
+//Benchmark for the renderer: draws scenes through Scene::draw (with lit_color_texture_program
+// and clustered lights, as PlayMode does) along scripted camera paths, into an offscreen
+// framebuffer, and reports frame times, draw calls, triangles, and GL state calls per frame.
+//
+//Usage:
+//  render-bench [--frames N] [--size WxH] [--window] [meshes.pnct scene.scene ...]
+//
+//With no scene arguments, benchmarks dist/Cheese.scene and dist/hexapod.scene.
+//
+//By default uses SDL's "offscreen" video driver (an EGL context with no window system),
+// so it runs on machines without a display; --window uses the usual driver instead.
+// For software rendering on Mesa, run with LIBGL_ALWAYS_SOFTWARE=1 (llvmpipe).
+//
+//Camera paths are functions of the frame number only, so runs are repeatable:
+//  camera -- the scene's own camera, held still
+//  orbit -- once around the scene's bounds, looking at the center
+//  fly -- through the scene along its longest horizontal axis
+
+#include "LitColorTextureProgram.hpp"
+#include "Mesh.hpp"
+#include "Scene.hpp"
+#include "Load.hpp"
+#include "GL.hpp"
+#include "GLState.hpp"
+#include "Profiler.hpp"
+#include "gl_errors.hpp"
+#include "data_path.hpp"
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//per-frame measurements:
+struct Frame {
+	double cpu_ms = 0.0; //time to issue the frame's GL commands
+	double frame_ms = 0.0; //...plus time until they finish (glFinish)
+	uint32_t drawables = 0;
+	uint32_t triangles = 0;
+	uint64_t gl_issued = 0;
+	uint64_t gl_skipped = 0;
+};
+
+//rotation that points a camera (which looks along its -z) in 'direction', keeping +z up:
+static glm::quat look_along(glm::vec3 const &direction) {
+	glm::vec3 back = -glm::normalize(direction);
+	glm::vec3 up = glm::vec3(0.0f, 0.0f, 1.0f);
+	if (std::abs(glm::dot(back, up)) > 0.999f) up = glm::vec3(0.0f, 1.0f, 0.0f);
+	glm::vec3 right = glm::normalize(glm::cross(up, back));
+	up = glm::cross(back, right);
+	return glm::quat_cast(glm::mat3(right, up, back));
+}
+
+static std::string format_ms(std::vector< double > values) {
+	std::sort(values.begin(), values.end());
+	double total = 0.0;
+	for (double v : values) total += v;
+	std::ostringstream str;
+	str << std::fixed << std::setprecision(2)
+		<< total / double(values.size())
+		<< " / " << values[values.size() / 2]
+		<< " / " << values[std::min(values.size() - 1, values.size() * 95 / 100)];
+	return str.str();
+}
+
+int main(int argc, char **argv) {
+	uint32_t frames = 240;
+	glm::uvec2 size = glm::uvec2(1280, 720);
+	bool offscreen = true;
+	std::vector< std::pair< std::string, std::string > > scenes;
+	{
+		bool usage = false;
+		std::vector< std::string > files;
+		for (int argi = 1; argi < argc; ++argi) {
+			std::string arg = argv[argi];
+			if (arg == "--frames" && argi + 1 < argc) {
+				frames = std::max(1U, uint32_t(std::stoul(argv[++argi])));
+			} else if (arg == "--size" && argi + 1 < argc) {
+				std::string wh = argv[++argi];
+				size_t x = wh.find('x');
+				if (x == std::string::npos) { usage = true; break; }
+				size = glm::uvec2(std::stoul(wh.substr(0, x)), std::stoul(wh.substr(x + 1)));
+				if (size.x == 0 || size.y == 0) { usage = true; break; }
+			} else if (arg == "--window") {
+				offscreen = false;
+			} else if (arg.size() > 0 && arg[0] == '-') {
+				usage = true;
+				break;
+			} else {
+				files.emplace_back(arg);
+			}
+		}
+		if (files.size() % 2 != 0) usage = true;
+		if (usage) {
+			std::cerr << "Usage:\n\t" << argv[0] << " [--frames N] [--size WxH] [--window] [meshes.pnct scene.scene ...]" << std::endl;
+			return 1;
+		}
+		for (size_t i = 0; i + 1 < files.size(); i += 2) {
+			scenes.emplace_back(files[i], files[i+1]);
+		}
+		if (scenes.empty()) {
+			//(this executable lives in bench/, next to dist/)
+			scenes.emplace_back(data_path("../dist/Cheese.pnct"), data_path("../dist/Cheese.scene"));
+			scenes.emplace_back(data_path("../dist/hexapod.pnct"), data_path("../dist/hexapod.scene"));
+		}
+	}
+
+	//------------  initialization ------------
+
+	if (offscreen) SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+	if (!SDL_Init(SDL_INIT_VIDEO)) {
+		std::cerr << "Error initializing SDL: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+
+	//Ask for an OpenGL context version 3.3, core profile:
+	SDL_GL_ResetAttributes();
+	SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+
+	//(frames are drawn into a framebuffer object, so the window itself is never shown)
+	SDL_Window *window = SDL_CreateWindow("render bench", 64, 64, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+	if (!window) {
+		std::cerr << "Error creating SDL window: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+
+	SDL_GLContext context = SDL_GL_CreateContext(window);
+	if (!context) {
+		SDL_DestroyWindow(window);
+		std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+
+	init_GL();
+	SDL_GL_SetSwapInterval(0);
+
+	call_load_functions();
+
+	//GPU timer queries (Scene::draw's PROFILE_GPU_SCOPE) would add to the timed frames:
+	Profiler::gpu_scopes_enabled = false;
+
+	//framebuffer to draw into:
+	GLuint color_rb = 0, depth_rb = 0, fb = 0;
+	glGenRenderbuffers(1, &color_rb);
+	glBindRenderbuffer(GL_RENDERBUFFER, color_rb);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+	glGenRenderbuffers(1, &depth_rb);
+	glBindRenderbuffer(GL_RENDERBUFFER, depth_rb);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size.x, size.y);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glGenFramebuffers(1, &fb);
+	glBindFramebuffer(GL_FRAMEBUFFER, fb);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color_rb);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_rb);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		std::cerr << "Error: offscreen framebuffer is incomplete." << std::endl;
+		return 1;
+	}
+	glViewport(0, 0, size.x, size.y);
+
+	std::cout << "Renderer: " << (char const *)glGetString(GL_RENDERER) << " (" << (char const *)glGetString(GL_VERSION) << ")" << std::endl;
+	std::cout << size.x << "x" << size.y << ", " << frames << " frames per path; times in ms (avg / median / 95th percentile), counts per frame." << std::endl;
+	std::cout << std::setw(14) << "scene" << std::setw(8) << "path"
+		<< std::setw(24) << "frame ms" << std::setw(24) << "cpu ms"
+		<< std::setw(8) << "draws" << std::setw(12) << "triangles"
+		<< std::setw(12) << "GL issued" << std::setw(12) << "GL skipped" << std::endl;
+
+	//------------ benchmark each scene --------------
+
+	LightClusters light_clusters;
+
+	for (auto const &[meshes_file, scene_file] : scenes) {
+		std::string name = scene_file.substr(scene_file.find_last_of("/\\") + 1);
+		if (!std::ifstream(meshes_file) || !std::ifstream(scene_file)) {
+			std::cout << std::setw(14) << name << "  (skipped: couldn't open '" << meshes_file << "' or '" << scene_file << "')" << std::endl;
+			continue;
+		}
+
+		MeshBuffer meshes(meshes_file);
+		GLuint vao = meshes.make_vao_for_program(lit_color_texture_program->program);
+
+		Scene scene;
+		scene.load(scene_file, [&](Scene &scene, Scene::Transform *transform, std::string const &mesh_name) {
+			auto f = meshes.meshes.find(mesh_name);
+			if (f == meshes.meshes.end()) return; //(e.g., collision-only objects)
+			Mesh const &mesh = f->second;
+
+			scene.drawables.emplace_back(transform);
+			Scene::Drawable &drawable = scene.drawables.back();
+
+			drawable.pipeline = lit_color_texture_program_pipeline;
+			drawable.pipeline.vao = vao;
+			drawable.pipeline.type = mesh.type;
+			drawable.pipeline.start = mesh.start;
+			drawable.pipeline.count = mesh.count;
+
+			drawable.min = mesh.min;
+			drawable.max = mesh.max;
+
+			for (auto const &lod : mesh.lods) {
+				drawable.lods.emplace_back(Scene::Drawable::LOD{lod.start, lod.count});
+			}
+		});
+
+		//world-space bounds of everything drawn:
+		glm::vec3 min = glm::vec3( std::numeric_limits< float >::infinity());
+		glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+		for (auto const &drawable : scene.drawables) {
+			glm::mat4x3 world_from_local = drawable.transform->make_world_from_local();
+			for (uint32_t c = 0; c < 8; ++c) {
+				glm::vec3 corner = glm::vec3(
+					(c & 1 ? drawable.max.x : drawable.min.x),
+					(c & 2 ? drawable.max.y : drawable.min.y),
+					(c & 4 ? drawable.max.z : drawable.min.z)
+				);
+				glm::vec3 world = world_from_local * glm::vec4(corner, 1.0f);
+				min = glm::min(min, world);
+				max = glm::max(max, world);
+			}
+		}
+		if (scene.drawables.empty()) {
+			std::cout << std::setw(14) << name << "  (skipped: nothing to draw)" << std::endl;
+			continue;
+		}
+		glm::vec3 center = 0.5f * (min + max);
+		float radius = std::max(1.0f, 0.5f * glm::length(max - min));
+
+		//benchmark camera (moved along each path):
+		scene.transforms.emplace_back();
+		Scene::Transform *eye = &scene.transforms.back();
+		eye->name = "render-bench eye";
+		Scene::Camera path_camera(eye);
+		path_camera.aspect = float(size.x) / float(size.y);
+
+		std::vector< std::pair< std::string, std::function< Scene::Camera const &(float) > > > paths;
+		if (!scene.cameras.empty()) {
+			paths.emplace_back("camera", [&](float) -> Scene::Camera const & {
+				scene.cameras.front().aspect = path_camera.aspect;
+				return scene.cameras.front();
+			});
+		}
+		paths.emplace_back("orbit", [&](float t) -> Scene::Camera const & {
+			float angle = t * 2.0f * 3.1415926f;
+			eye->position = center + radius * glm::vec3(1.2f * std::cos(angle), 1.2f * std::sin(angle), 0.5f);
+			eye->rotation = look_along(center - eye->position);
+			return path_camera;
+		});
+		paths.emplace_back("fly", [&](float t) -> Scene::Camera const & {
+			glm::vec3 axis = (max.x - min.x > max.y - min.y ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f));
+			glm::vec3 side = glm::vec3(-axis.y, axis.x, 0.0f);
+			eye->position = glm::mix(min, max, 0.5f) * (glm::vec3(1.0f) - axis) + glm::mix(min, max, t) * axis
+				+ glm::vec3(0.0f, 0.0f, 0.25f * (max.z - min.z));
+			eye->rotation = look_along(axis + 0.3f * std::sin(t * 6.2831853f) * side - glm::vec3(0.0f, 0.0f, 0.1f));
+			return path_camera;
+		});
+
+		for (auto const &[path_name, camera_at] : paths) {
+			std::vector< Frame > results;
+			results.reserve(frames);
+			uint32_t const warmup = std::min(frames, 10U);
+			for (uint32_t f = 0; f < warmup + frames; ++f) {
+				float t = float(f < warmup ? 0 : f - warmup) / float(frames);
+				Scene::Camera const &camera = camera_at(t);
+
+				//(profiler frame boundaries are outside the timed part; they keep scope events and counters from piling up)
+				Profiler::begin_frame();
+
+				auto before = std::chrono::high_resolution_clock::now();
+
+				glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+				glClearDepth(1.0f);
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+				GLState::enable(GL_DEPTH_TEST);
+				glDepthFunc(GL_LESS);
+
+				//same lights as PlayMode::draw:
+				light_clusters.clear();
+				bool has_sky = false;
+				for (auto const &light : scene.lights) {
+					light_clusters.add(light);
+					has_sky = has_sky || light.type == Scene::Light::Hemisphere || light.type == Scene::Light::Directional;
+				}
+				if (!has_sky) {
+					light_clusters.add(Scene::Light::Hemisphere, glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(1.0f, 1.0f, 0.95f));
+				}
+				light_clusters.update(camera, size);
+				light_clusters.bind();
+
+				scene.draw(camera);
+
+				auto issued = std::chrono::high_resolution_clock::now();
+				glFinish();
+				auto finished = std::chrono::high_resolution_clock::now();
+
+				Frame frame;
+				frame.cpu_ms = std::chrono::duration< double, std::milli >(issued - before).count();
+				frame.frame_ms = std::chrono::duration< double, std::milli >(finished - before).count();
+				frame.drawables = scene.draw_stats.drawables;
+				frame.triangles = scene.draw_stats.triangles;
+				frame.gl_issued = GLState::counts().issued;
+				frame.gl_skipped = GLState::counts().skipped;
+				GLState::end_frame();
+				Profiler::end_frame();
+
+				if (f >= warmup) results.emplace_back(frame);
+			}
+			GL_ERRORS();
+
+			std::vector< double > frame_ms, cpu_ms;
+			double drawables = 0.0, triangles = 0.0, issued = 0.0, skipped = 0.0;
+			for (auto const &frame : results) {
+				frame_ms.emplace_back(frame.frame_ms);
+				cpu_ms.emplace_back(frame.cpu_ms);
+				drawables += frame.drawables;
+				triangles += frame.triangles;
+				issued += double(frame.gl_issued);
+				skipped += double(frame.gl_skipped);
+			}
+			double n = double(results.size());
+			std::cout << std::setw(14) << name << std::setw(8) << path_name
+				<< std::setw(24) << format_ms(frame_ms) << std::setw(24) << format_ms(cpu_ms)
+				<< std::fixed << std::setprecision(0)
+				<< std::setw(8) << drawables / n << std::setw(12) << triangles / n
+				<< std::setw(12) << issued / n << std::setw(12) << skipped / n << std::endl;
+		}
+
+		GLState::delete_vertex_arrays(1, &vao);
+		GLState::delete_buffers(1, &meshes.buffer);
+	}
+
+	//------------  teardown ------------
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &fb);
+	glDeleteRenderbuffers(1, &color_rb);
+	glDeleteRenderbuffers(1, &depth_rb);
+
+	Profiler::shutdown();
+
+	SDL_GL_DestroyContext(context);
+	context = 0;
+
+	SDL_DestroyWindow(window);
+	window = NULL;
+
+	return 0;
+}
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+
+#Adds simplified versions ("levels of detail") of every mesh in a .pnct file.
+#Usage:
+#python3 make-lods.py <infile.pnct> <outfile.pnct> [--levels N] [--min-triangles M]
+#
+#For each mesh "Name" with at least M triangles (default 64), writes up to N (default 3)
+# extra meshes "Name@lod1", "Name@lod2", ... with about 1/2, 1/4, ... of the triangles.
+# MeshBuffer (Mesh.cpp) gathers these into Name's LOD chain.
+#
+#Simplification is by greedy edge collapse, ordered by quadric error (Garland & Heckbert '97):
+# vertices are welded by position; each collapse moves one endpoint onto the other
+# (so surviving positions are original positions, and each triangle corner keeps its
+# own normal / color / texcoord); open edges get extra "fence" quadrics so mesh
+# outlines stay put; and collapses that would flip a triangle are skipped.
+
+import sys
+import struct
+import heapq
+
+args = sys.argv[1:]
+levels = 3
+min_triangles = 64
+files = []
+i = 0
+while i < len(args):
+	if args[i] == '--levels' and i + 1 < len(args):
+		levels = int(args[i+1])
+		i += 2
+	elif args[i] == '--min-triangles' and i + 1 < len(args):
+		min_triangles = int(args[i+1])
+		i += 2
+	else:
+		files.append(args[i])
+		i += 1
+
+if len(files) != 2 or not files[0].endswith('.pnct') or not files[1].endswith('.pnct'):
+	print("\n\nUsage:\npython3 make-lods.py <infile.pnct> <outfile.pnct> [--levels N] [--min-triangles M]\nAdds simplified versions of every mesh in a .pnct file.\n")
+	exit(1)
+
+infile, outfile = files
+
+VERTEX = struct.Struct('3f3f4B2f')
+assert VERTEX.size == 4*3+4*3+1*4+4*2
+
+#---------------- reading ----------------
+
+def read_chunk(blob, at, magic):
+	(got, length) = struct.unpack_from('4sI', blob, at)
+	if got != magic:
+		print("Expected chunk '" + magic.decode() + "' but found '" + got.decode() + "'.")
+		exit(1)
+	return (blob[at+8:at+8+length], at + 8 + length)
+
+blob = open(infile, 'rb').read()
+(data, at) = read_chunk(blob, 0, b'pnct')
+(strings, at) = read_chunk(blob, at, b'str0')
+(index, at) = read_chunk(blob, at, b'idx0')
+if at != len(blob):
+	print("WARNING: trailing data in '" + infile + "'.")
+
+vertices = [ VERTEX.unpack_from(data, o) for o in range(0, len(data), VERTEX.size) ]
+
+meshes = []
+for o in range(0, len(index), 16):
+	(name_begin, name_end, vertex_begin, vertex_end) = struct.unpack_from('4I', index, o)
+	meshes.append((strings[name_begin:name_end].decode('utf8'), vertex_begin, vertex_end))
+
+#---------------- simplification ----------------
+
+def sub(a, b): return (a[0]-b[0], a[1]-b[1], a[2]-b[2])
+def cross(a, b): return (a[1]*b[2]-a[2]*b[1], a[2]*b[0]-a[0]*b[2], a[0]*b[1]-a[1]*b[0])
+def dot(a, b): return a[0]*b[0] + a[1]*b[1] + a[2]*b[2]
+
+#quadrics are stored as the 10 unique entries of a symmetric 4x4 matrix:
+def plane_quadric(n, d, w):
+	(a, b, c) = n
+	return [w*a*a, w*a*b, w*a*c, w*a*d, w*b*b, w*b*c, w*b*d, w*c*c, w*c*d, w*d*d]
+
+def add_quadric(q, r):
+	for k in range(10): q[k] += r[k]
+
+def quadric_error(q, p):
+	(x, y, z) = p
+	return (q[0]*x*x + 2*q[1]*x*y + 2*q[2]*x*z + 2*q[3]*x
+		+ q[4]*y*y + 2*q[5]*y*z + 2*q[6]*y
+		+ q[7]*z*z + 2*q[8]*z
+		+ q[9])
+
+def simplify(corners, target):
+	"""corners: list of vertex tuples (three per triangle). Returns a smaller list in the same format."""
+
+	#weld by position:
+	ids = {}
+	positions = []
+	faces = [] #[ [id, id, id], corner index of first corner ]
+	for t in range(0, len(corners), 3):
+		face = []
+		for k in range(3):
+			p = corners[t+k][0:3]
+			if p not in ids:
+				ids[p] = len(positions)
+				positions.append(p)
+			face.append(ids[p])
+		if face[0] != face[1] and face[1] != face[2] and face[2] != face[0]:
+			faces.append([face, t])
+
+	vertex_faces = [ set() for _ in positions ]
+	for f, (face, _) in enumerate(faces):
+		for v in face: vertex_faces[v].add(f)
+
+	#quadrics from face planes (area-weighted):
+	quadrics = [ [0.0]*10 for _ in positions ]
+	edge_faces = {}
+	for f, (face, _) in enumerate(faces):
+		(a, b, c) = [ positions[v] for v in face ]
+		n = cross(sub(b, a), sub(c, a))
+		area2 = dot(n, n) ** 0.5
+		if area2 == 0.0: continue
+		n = (n[0]/area2, n[1]/area2, n[2]/area2)
+		q = plane_quadric(n, -dot(n, a), 0.5 * area2)
+		for v in face: add_quadric(quadrics[v], q)
+		for k in range(3):
+			e = (min(face[k], face[(k+1)%3]), max(face[k], face[(k+1)%3]))
+			edge_faces.setdefault(e, []).append((f, n))
+
+	#fence quadrics on open edges:
+	for (a, b), on in edge_faces.items():
+		if len(on) != 1: continue
+		(f, n) = on[0]
+		d = sub(positions[b], positions[a])
+		length = dot(d, d) ** 0.5
+		if length == 0.0: continue
+		fence = cross(d, n)
+		fence_length = dot(fence, fence) ** 0.5
+		if fence_length == 0.0: continue
+		fence = (fence[0]/fence_length, fence[1]/fence_length, fence[2]/fence_length)
+		q = plane_quadric(fence, -dot(fence, positions[a]), 10.0 * length * length)
+		add_quadric(quadrics[a], q)
+		add_quadric(quadrics[b], q)
+
+	alive = [ True ] * len(faces)
+	live_faces = len(faces)
+	version = [ 0 ] * len(positions)
+
+	def face_normal(face, moved, to):
+		(a, b, c) = [ (to if v == moved else positions[v]) for v in face ]
+		return cross(sub(b, a), sub(c, a))
+
+	#would moving vertex 'b' onto 'a' flip any triangle that survives?
+	def flips(b, a):
+		for f in vertex_faces[b]:
+			face = faces[f][0]
+			if a in face: continue #(removed by the collapse)
+			before = face_normal(face, -1, None)
+			after = face_normal(face, b, positions[a])
+			if dot(before, after) <= 0.0: return True
+		return False
+
+	def push(heap, a, b):
+		q = [ x + y for (x, y) in zip(quadrics[a], quadrics[b]) ]
+		#collapse onto whichever endpoint is cheaper:
+		cost_a = quadric_error(q, positions[a])
+		cost_b = quadric_error(q, positions[b])
+		if cost_b < cost_a: (a, b, cost_a) = (b, a, cost_b)
+		heapq.heappush(heap, (cost_a, b, a, version[a], version[b]))
+
+	heap = []
+	for (a, b) in edge_faces:
+		push(heap, a, b)
+
+	while live_faces > target and heap:
+		(cost, b, a, version_a, version_b) = heapq.heappop(heap)
+		if version[a] != version_a or version[b] != version_b: continue #stale
+		if flips(b, a): continue
+
+		#collapse b onto a:
+		for f in list(vertex_faces[b]):
+			face = faces[f][0]
+			if a in face:
+				alive[f] = False
+				live_faces -= 1
+				for v in face: vertex_faces[v].discard(f)
+			else:
+				face[face.index(b)] = a
+				vertex_faces[a].add(f)
+		vertex_faces[b] = set()
+		add_quadric(quadrics[a], quadrics[b])
+		version[a] += 1
+		version[b] += 1
+
+		neighbors = set()
+		for f in vertex_faces[a]:
+			neighbors.update(faces[f][0])
+		neighbors.discard(a)
+		for n in neighbors:
+			push(heap, a, n)
+
+	out = []
+	for f, (face, t) in enumerate(faces):
+		if not alive[f]: continue
+		for k in range(3):
+			corner = corners[t+k]
+			out.append(positions[face[k]] + corner[3:])
+	return out
+
+#---------------- writing ----------------
+
+out_vertices = list(vertices)
+out_meshes = list(meshes)
+for (name, begin, end) in meshes:
+	corners = vertices[begin:end]
+	triangles = len(corners) // 3
+	if triangles < min_triangles: continue
+	previous = triangles
+	for level in range(1, levels + 1):
+		target = triangles >> level
+		if target < 8: break
+		corners = simplify(corners, target)
+		#stop once simplification stalls (e.g., everything left is needed for the outline):
+		if len(corners) // 3 > 0.9 * previous: break
+		previous = len(corners) // 3
+		out_meshes.append((name + '@lod' + str(level), len(out_vertices), len(out_vertices) + len(corners)))
+		out_vertices.extend(corners)
+	if previous != triangles:
+		print(name + ": " + str(triangles) + " triangles -> " + " -> ".join([ str((m[2]-m[1])//3) for m in out_meshes if m[0].startswith(name + '@lod') ]))
+
+out_data = b''.join([ VERTEX.pack(*v) for v in out_vertices ])
+out_strings = b''
+out_index = b''
+for (name, begin, end) in out_meshes:
+	encoded = name.encode('utf8')
+	out_index += struct.pack('4I', len(out_strings), len(out_strings) + len(encoded), begin, end)
+	out_strings += encoded
+
+blob = open(outfile, 'wb')
+blob.write(struct.pack('4sI', b'pnct', len(out_data)))
+blob.write(out_data)
+blob.write(struct.pack('4sI', b'str0', len(out_strings)))
+blob.write(out_strings)
+blob.write(struct.pack('4sI', b'idx0', len(out_index)))
+blob.write(out_index)
+wrote = blob.tell()
+blob.close()
+
+print("Wrote " + str(wrote) + " bytes (" + str(len(out_meshes) - len(meshes)) + " LOD meshes added) to '" + outfile + "'")